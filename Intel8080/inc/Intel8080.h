@@ -47,6 +47,8 @@ namespace EightBit {
 		void handleRESET() noexcept final;
 		void handleINT() noexcept final;
 
+		[[nodiscard]] bool spinning() noexcept final;
+
 		void memoryUpdate(int ticks = 1) noexcept final;
 		void memoryWrite() noexcept final;
 		void memoryRead() noexcept final;
@@ -102,19 +104,13 @@ namespace EightBit {
 		[[nodiscard]] static constexpr uint8_t adjustZero(uint8_t input, uint8_t value) noexcept { return clearBit(input, ZF, value); }
 
 		void adjustParity(uint8_t value) noexcept { adjustStatusFlags(adjustParity(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustParity(uint8_t input, uint8_t value) noexcept { return setBit(input, PF, evenParity(value)); }
+		[[nodiscard]] static constexpr uint8_t adjustParity(uint8_t input, uint8_t value) noexcept { return IntelProcessor::adjustParity<Intel8080>(input, value); }
 
 		void adjustSZ(uint8_t value) noexcept { adjustStatusFlags(adjustSZ(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZ(uint8_t input, uint8_t value) noexcept {
-			input = adjustSign(input, value);
-			return adjustZero(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZ(uint8_t input, uint8_t value) noexcept { return IntelProcessor::adjustSZ<Intel8080>(input, value); }
 
 		void adjustSZP(uint8_t value) noexcept { adjustStatusFlags(adjustSZP(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZP(uint8_t input, uint8_t value) noexcept {
-			input = adjustSZ(input, value);
-			return adjustParity(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZP(uint8_t input, uint8_t value) noexcept { return IntelProcessor::adjustSZP<Intel8080>(input, value); }
 
 		[[nodiscard]] static constexpr auto adjustAuxilliaryCarryAdd(uint8_t f, uint8_t before, uint8_t value, int calculation) noexcept {
 			return setBit(f, AC, calculateHalfCarryAdd(before, value, calculation));
@@ -164,6 +160,12 @@ namespace EightBit {
 
 		void daa();
 
+		// DAA depends upon nothing but A and the carry and auxiliary carry flags, so
+		// every result (flags low, A high) is worked out at compile time.
+		[[nodiscard]] static constexpr auto daaIndex(const uint8_t a, const uint8_t f) noexcept { return a | ((f & CF) << 8) | ((f & AC) << 5); }
+		[[nodiscard]] static constexpr register16_t decimalAdjust(uint8_t a, uint8_t f) noexcept;
+		static const std::array<register16_t, 0x400> m_daa;
+
 		void cma();
 		void stc();
 		void cmc();
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace EightBit {
 	class Profiler {
@@ -14,9 +15,13 @@ namespace EightBit {
 
 		void dump() const;
 
+		// Bytes allocated for the counters
+		[[nodiscard]] size_t footprint() const noexcept;
+
 	private:
-		std::array<uint64_t, 0x100> m_instructions;
-		std::array<uint64_t, 0x10000> m_addresses;
+		// Left empty until the first count, so an idle profiler costs next to nothing
+		std::vector<uint64_t> m_instructions;
+		std::vector<uint64_t> m_addresses;
 
 		void dumpInstructionProfiles() const;
 		void dumpAddressProfiles() const;
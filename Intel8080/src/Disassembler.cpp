@@ -446,7 +446,7 @@ std::string EightBit::Disassembler::flags(uint8_t value) {
 }
 
 std::string EightBit::Disassembler::hex(uint8_t value) {
-	static char digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' , 'a', 'b', 'c', 'd', 'e', 'f' };
+	static const char digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' , 'a', 'b', 'c', 'd', 'e', 'f' };
 	std::string returned;
 	returned.reserve(2);
 	returned += digits[Chip::highNibble(value)];
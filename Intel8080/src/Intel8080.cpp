@@ -276,19 +276,37 @@ void EightBit::Intel8080::rr() {
 }
 
 void EightBit::Intel8080::daa() {
-	const auto& before = A();
-	auto carry = F() & CF;
+	const auto adjusted = m_daa[daaIndex(A(), F())];
+	F() = (F() & ~(SF | ZF | AC | PF | CF)) | adjusted.low;
+	A() = adjusted.high;
+}
+
+constexpr EightBit::register16_t EightBit::Intel8080::decimalAdjust(const uint8_t a, uint8_t f) noexcept {
+	auto carry = carryTest(f);
 	uint8_t addition = 0;
-	if (auxiliaryCarry() || lowNibble(before) > 9) {
+	if (auxiliaryCarryTest(f) || lowNibble(a) > 9) {
 		addition = 0x6;
 	}
-	if ((F() & CF) || highNibble(before) > 9 || (highNibble(before) >= 9 && lowNibble(before) > 9)) {
+	if (carryTest(f) || highNibble(a) > 9 || (highNibble(a) >= 9 && lowNibble(a) > 9)) {
 		addition |= 0x60;
 		carry = true;
 	}
-	add(addition);
-	F() = setBit(F(), CF, carry);
-}
+	const int sum = a + addition;
+	const auto result = lowByte(sum);
+	f = adjustAuxilliaryCarryAdd(f, a, addition, sum);
+	f = adjustSZP(f, result);
+	f = setBit(f, CF, carry);
+	return { f, result };
+}
+
+constexpr std::array<EightBit::register16_t, 0x400> EightBit::Intel8080::m_daa = [] {
+	std::array<register16_t, 0x400> adjusted;
+	for (int index = 0; index < 0x400; ++index) {
+		const uint8_t f = ((index >> 8) & CF) | ((index >> 5) & AC);
+		adjusted[index] = decimalAdjust(index & Mask8, f);
+	}
+	return adjusted;
+}();
 
 void EightBit::Intel8080::cma() {
 	A() = ~A();
@@ -342,6 +360,26 @@ void EightBit::Intel8080::readPort() noexcept {
 	tick(2);
 }
 
+// Halted, or a jump to itself
+bool EightBit::Intel8080::spinning() noexcept {
+
+	if (lowered(RESET()) || (lowered(INT()) && m_interruptEnable))
+		return false;
+
+	if (halted())
+		return true;
+
+	switch (opcode()) {
+	case 0xc3:											// JMP
+	case 0xc2: case 0xca: case 0xd2: case 0xda:			// Jcc
+	case 0xe2: case 0xea: case 0xf2: case 0xfa:
+	case 0xe9:											// PCHL
+		return true;
+	default:
+		return false;
+	}
+}
+
 void EightBit::Intel8080::poweredStep() noexcept {
 	if (UNLIKELY(lowered(RESET()))) {
 		handleRESET();
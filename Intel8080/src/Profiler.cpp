@@ -4,22 +4,27 @@
 
 #include <iostream>
 
-EightBit::Profiler::Profiler() noexcept {
-	m_instructions.fill(0);
-	m_addresses.fill(0);
-}
+EightBit::Profiler::Profiler() noexcept {}
 
 EightBit::Profiler::~Profiler() {
 }
 
 void EightBit::Profiler::addInstruction(uint8_t instruction) {
+	if (m_instructions.empty())
+		m_instructions.resize(0x100);
 	m_instructions[instruction]++;
 }
 
 void EightBit::Profiler::addAddress(uint16_t address) {
+	if (m_addresses.empty())
+		m_addresses.resize(0x10000);
 	m_addresses[address]++;
 }
 
+size_t EightBit::Profiler::footprint() const noexcept {
+	return (m_instructions.capacity() + m_addresses.capacity()) * sizeof(uint64_t);
+}
+
 void EightBit::Profiler::dump() const {
 	dumpInstructionProfiles();
 	dumpAddressProfiles();
@@ -27,7 +32,7 @@ void EightBit::Profiler::dump() const {
 
 void EightBit::Profiler::dumpInstructionProfiles() const {
 	std::cout << "** instructions" << std::endl;
-	for (int i = 0; i < 0x100; ++i) {
+	for (size_t i = 0; i < m_instructions.size(); ++i) {
 		auto count = m_instructions[i];
 		if (count > 0)
 			std::cout << Disassembler::hex((uint8_t)i) << "\t" << count << std::endl;
@@ -36,7 +41,7 @@ void EightBit::Profiler::dumpInstructionProfiles() const {
 
 void EightBit::Profiler::dumpAddressProfiles() const {
 	std::cout << "** addresses" << std::endl;
-	for (int i = 0; i < 0x10000; ++i) {
+	for (size_t i = 0; i < m_addresses.size(); ++i) {
 		auto count = m_addresses[i];
 		if (count > 0)
 			std::cout << Disassembler::hex((uint16_t)i) << "\t" << count << std::endl;
@@ -35,7 +35,8 @@ void Board::initialise() noexcept {
 		lowerPOWER();
 	});
 
-	m_cpu.ExecutingInstruction.connect(std::bind(&Board::Cpu_ExecutingInstruction_Cpm, this, std::placeholders::_1));
+	m_cpu.trap(0x0, std::bind(&Board::Cpu_WarmStart, this, std::placeholders::_1));	// CP/M warm start
+	m_cpu.trap(0x5, [this](EightBit::EventArgs&) { bdos(); });						// BDOS
 
 	if (m_configuration.isProfileMode()) {
 		m_cpu.ExecutingInstruction.connect(std::bind(&Board::Cpu_ExecutingInstruction_Profile, this, std::placeholders::_1));
@@ -49,23 +50,16 @@ void Board::initialise() noexcept {
 	CPU().pokeShort(1, m_configuration.getStartAddress());
 
 	poke(5, 0xc9); // ret
+
+	remap();
 }
 
-void Board::Cpu_ExecutingInstruction_Cpm(EightBit::EventArgs&) {
-	switch (CPU().PC().joined) {
-	case 0x0:	// CP/M warm start
-		if (++m_warmstartCount == 2) {
-			lowerPOWER();
-			if (m_configuration.isProfileMode()) {
-				m_profiler.dump();
-			}
+void Board::Cpu_WarmStart(EightBit::EventArgs&) {
+	if (++m_warmstartCount == 2) {
+		lowerPOWER();
+		if (m_configuration.isProfileMode()) {
+			m_profiler.dump();
 		}
-		break;
-	case 0x5:	// BDOS
-		bdos();
-		break;
-	default:
-		break;
 	}
 }
 
@@ -22,8 +22,12 @@ public:
 
 	virtual void initialise() noexcept final;
 
+	[[nodiscard]] size_t footprint() noexcept final {
+		return EightBit::Bus::footprint() + m_ports.footprint() + m_profiler.footprint();
+	}
+
 protected:
-	virtual const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final {
+	virtual EightBit::MemoryMapping mapping(uint16_t address) noexcept final {
 		return m_mapping;
 	}
 
@@ -37,7 +41,7 @@ private:
 	EightBit::Profiler m_profiler;
 	int m_warmstartCount = 0;
 
-	void Cpu_ExecutingInstruction_Cpm(EightBit::EventArgs&);
+	void Cpu_WarmStart(EightBit::EventArgs&);
 
 	void Cpu_ExecutingInstruction_Debug(const EightBit::EventArgs&);
 	void Cpu_ExecutingInstruction_Profile(EightBit::EventArgs&);
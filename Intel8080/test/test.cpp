@@ -3,7 +3,7 @@
 #include "Board.h"
 #include "Configuration.h"
 
-int main(int, char*[]) {
+int main(int argc, char* argv[]) {
 
 	Configuration configuration;
 
@@ -13,6 +13,8 @@ int main(int, char*[]) {
 #endif
 
 	EightBit::TestHarness<Configuration, Board> harness(configuration);
+	if (!harness.parse(argc, argv))
+		return 1;
 	harness.run();
 
 	return 0;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cassert>
+#include <array>
 
 #include <IntelProcessor.h>
 #include <Signal.h>
@@ -139,6 +140,12 @@ namespace EightBit {
 
 			[[nodiscard]] static uint8_t daa(uint8_t& f, uint8_t operand);
 
+			// DAA depends upon nothing but A and the subtract, half carry and carry flags,
+			// so every result (flags low, A high) is worked out at compile time.
+			[[nodiscard]] static constexpr auto daaIndex(const uint8_t a, const uint8_t f) { return a | ((f & (NF | HC | CF)) << 4); }
+			[[nodiscard]] static constexpr register16_t decimalAdjust(uint8_t a, uint8_t f);
+			static const std::array<register16_t, 0x800> m_daa;
+
 			static void scf(uint8_t& f, uint8_t operand);
 			static void ccf(uint8_t& f, uint8_t operand);
 			[[nodiscard]] static uint8_t cpl(uint8_t& f, uint8_t operand);
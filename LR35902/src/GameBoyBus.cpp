@@ -5,7 +5,7 @@
 EightBit::GameBoy::Bus::Bus()
 : m_cpu(*this),
   m_ioPorts(*this) {
-	WrittenByte.connect(std::bind(&GameBoy::Bus::Bus_WrittenByte, this, std::placeholders::_1));
+	attachWriteOnly(0x0000, 0x7fff, std::bind(&GameBoy::Bus::Bus_WrittenByte, this, std::placeholders::_1));	// Cartridge MBC registers
 }
 
 void EightBit::GameBoy::Bus::raisePOWER() noexcept {
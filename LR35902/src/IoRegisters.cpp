@@ -5,8 +5,9 @@
 EightBit::GameBoy::IoRegisters::IoRegisters(Bus& bus)
 : Ram(0x80),
   m_bus(bus) {
-	m_bus.ReadingByte.connect(std::bind(&IoRegisters::Bus_ReadingByte, this, std::placeholders::_1));
-	m_bus.WrittenByte.connect(std::bind(&IoRegisters::Bus_WrittenByte, this, std::placeholders::_1));
+	m_bus.attach(BASE, BASE + 0x7f,
+		std::bind(&IoRegisters::Bus_ReadingByte, this, std::placeholders::_1),
+		std::bind(&IoRegisters::Bus_WrittenByte, this, std::placeholders::_1));
 }
 
 void EightBit::GameBoy::IoRegisters::reset() {
@@ -24,69 +25,65 @@ void EightBit::GameBoy::IoRegisters::transferDma() {
 }
 
 void EightBit::GameBoy::IoRegisters::Bus_ReadingByte(EightBit::EventArgs) {
-	const auto address = m_bus.ADDRESS().word;
-	const auto io = (address >= BASE) && (address < 0xff80);
-	if (io) {
-		auto port = address - BASE;
-		switch (port) {
-
-		// Port/Mode Registers
-		case P1: {
-				auto directionKeys = m_scanP14 && !m_p14;
-				auto miscKeys = m_scanP15 && !m_p15;
-				auto live = directionKeys || miscKeys;
-				auto rightOrA = (live && !m_p10) ? 0 : Chip::Bit0;
-				auto leftOrB = (live && !m_p11) ? 0 : Chip::Bit1;
-				auto upOrSelect = (live && !m_p12) ? 0 : Chip::Bit2;
-				auto downOrStart = (live && !m_p13) ? 0 : Chip::Bit3;
-				auto lowNibble = rightOrA | leftOrB | upOrSelect | downOrStart;
-				constexpr auto highNibble = Chip::promoteNibble(Chip::Mask4);
-				auto value = lowNibble | highNibble;
-				poke(port, lowNibble | highNibble);
-			}
-			break;
-		case SB:
-			break;
-		case SC:
-			mask(port, Chip::Bit7 | Chip::Bit0);
-			break;
-
-		// Timer control
-		case DIV:
-		case TIMA:
-		case TMA:
-			break;
-		case TAC:
-			mask(port, Chip::Mask3);
-			break;
-
-		// Interrupt Flags
-		case IF:
-			mask(port, Chip::Mask5);
-			break;
-
-		// LCD Display Registers
-		case LCDC:
-			break;
-		case STAT:
-			mask(port, Chip::Mask7);
-			break;
-		case SCY:
-		case SCX:
-		case LY:
-		case LYC:
-		case DMA:
-		case BGP:
-		case OBP0:
-		case OBP1:
-		case WY:
-		case WX:
-			break;
-
-		default:
-			mask(port, 0);
-			break;
+	const auto port = m_bus.ADDRESS().word - BASE;
+	switch (port) {
+
+	// Port/Mode Registers
+	case P1: {
+			auto directionKeys = m_scanP14 && !m_p14;
+			auto miscKeys = m_scanP15 && !m_p15;
+			auto live = directionKeys || miscKeys;
+			auto rightOrA = (live && !m_p10) ? 0 : Chip::Bit0;
+			auto leftOrB = (live && !m_p11) ? 0 : Chip::Bit1;
+			auto upOrSelect = (live && !m_p12) ? 0 : Chip::Bit2;
+			auto downOrStart = (live && !m_p13) ? 0 : Chip::Bit3;
+			auto lowNibble = rightOrA | leftOrB | upOrSelect | downOrStart;
+			constexpr auto highNibble = Chip::promoteNibble(Chip::Mask4);
+			auto value = lowNibble | highNibble;
+			poke(port, lowNibble | highNibble);
 		}
+		break;
+	case SB:
+		break;
+	case SC:
+		mask(port, Chip::Bit7 | Chip::Bit0);
+		break;
+
+	// Timer control
+	case DIV:
+	case TIMA:
+	case TMA:
+		break;
+	case TAC:
+		mask(port, Chip::Mask3);
+		break;
+
+	// Interrupt Flags
+	case IF:
+		mask(port, Chip::Mask5);
+		break;
+
+	// LCD Display Registers
+	case LCDC:
+		break;
+	case STAT:
+		mask(port, Chip::Mask7);
+		break;
+	case SCY:
+	case SCX:
+	case LY:
+	case LYC:
+	case DMA:
+	case BGP:
+	case OBP0:
+	case OBP1:
+	case WY:
+	case WX:
+		break;
+
+	default:
+		mask(port, 0);
+		break;
 	}
 }
 
@@ -392,8 +392,14 @@ uint8_t EightBit::GameBoy::LR35902::set(const int n, const uint8_t operand) {
 }
 
 uint8_t EightBit::GameBoy::LR35902::daa(uint8_t& f, uint8_t operand) {
+	const auto adjusted = m_daa[daaIndex(operand, f)];
+	f = (f & ~(ZF | NF | HC | CF)) | adjusted.low;
+	return adjusted.high;
+}
+
+constexpr EightBit::register16_t EightBit::GameBoy::LR35902::decimalAdjust(const uint8_t a, uint8_t f) {
 
-	int updated = operand;
+	int updated = a;
 
 	if (f & NF) {
 		if (f & HC)
@@ -413,9 +419,18 @@ uint8_t EightBit::GameBoy::LR35902::daa(uint8_t& f, uint8_t operand) {
 
 	f = adjustZero<LR35902>(f, result);
 
-	return result;
+	return { f, result };
 }
 
+constexpr std::array<EightBit::register16_t, 0x800> EightBit::GameBoy::LR35902::m_daa = [] {
+	std::array<register16_t, 0x800> adjusted;
+	for (int index = 0; index < 0x800; ++index) {
+		const uint8_t f = (index >> 4) & (NF | HC | CF);
+		adjusted[index] = decimalAdjust(index & Mask8, f);
+	}
+	return adjusted;
+}();
+
 uint8_t EightBit::GameBoy::LR35902::cpl(uint8_t& f, const uint8_t operand) {
 	f = setBit(f, HC | NF);
 	return ~operand;
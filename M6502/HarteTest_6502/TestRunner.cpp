@@ -1,7 +1,13 @@
 #include "stdafx.h"
 #include "TestRunner.h"
 
-TestRunner::TestRunner() {}
+TestRunner::TestRunner(const bool translated)
+: m_translated(translated) {
+    if (translated) {
+        CPU().mode() = EightBit::MOS6502::mode_t::Fast;
+        CPU().translate(true, 1, 1);
+    }
+}
 
 void TestRunner::raisePOWER() noexcept {
     EightBit::Bus::raisePOWER();
@@ -18,4 +24,6 @@ void TestRunner::lowerPOWER() noexcept {
     EightBit::Bus::lowerPOWER();
 }
 
-void TestRunner::initialise() noexcept {}
+void TestRunner::initialise() noexcept {
+    remap();
+}
@@ -9,12 +9,13 @@ private:
     EightBit::Ram m_ram = 0x10000;
     EightBit::MOS6502 m_cpu = { *this };
 	EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+    bool m_translated = false;
 
 protected:
-    const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final { return m_mapping; }
+    EightBit::MemoryMapping mapping(uint16_t address) noexcept final { return m_mapping; }
 
 public:
-    TestRunner();
+    TestRunner(bool translated = false);
 
     void raisePOWER() noexcept final;
     void lowerPOWER() noexcept final;
@@ -23,4 +24,7 @@ public:
 
     [[nodiscard]] constexpr auto& RAM() noexcept { return m_ram; }
     [[nodiscard]] constexpr auto& CPU() noexcept { return m_cpu; }
+
+    // Fast mode, translating every instruction on its own, as soon as it's seen
+    [[nodiscard]] constexpr auto translated() const noexcept { return m_translated; }
 };
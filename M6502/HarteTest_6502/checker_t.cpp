@@ -107,19 +107,26 @@ void checker_t::initialiseState(const test_t test) {
 		const auto value = byte.value();
         ram.poke(address, value);
     }
+
+    // RAM has been changed behind the bus, so any translations are stale
+    cpu.flush();
 }
 
 void checker_t::initialise() {
 
     auto& bus = runner();
 
-    bus.CPU().ReadMemory.connect([this](EightBit::EventArgs&) {
-        addActualReadCycle(runner().ADDRESS(), runner().DATA());
-    });
+    // Translated code only runs while nothing is watching the bus
+    if (!bus.translated()) {
+
+        bus.CPU().ReadMemory.connect([this](EightBit::EventArgs&) {
+            addActualReadCycle(runner().ADDRESS(), runner().DATA());
+        });
 
-    bus.CPU().WrittenMemory.connect([this](EightBit::EventArgs&) {
-        addActualWriteCycle(runner().ADDRESS(), runner().DATA());
-    });
+        bus.CPU().WrittenMemory.connect([this](EightBit::EventArgs&) {
+            addActualWriteCycle(runner().ADDRESS(), runner().DATA());
+        });
+    }
 
     os() << std::hex << std::uppercase;
 }
@@ -133,33 +140,44 @@ bool checker_t::checkState(test_t test) {
     const auto& expected_cycles = test.cycles();
     const auto& actual_cycles = m_actualCycles;
 
-    size_t actual_idx = 0;
-    for (const auto expected_cycle : expected_cycles) {
+    if (runner().translated()) {
 
-        if (actual_idx >= actual_cycles.size()) {
+        // Without bus events, only the number of cycles can be compared
+        if (cycles() != static_cast<int>(expected_cycles.size())) {
             m_cycle_count_mismatch = true;
-            return false; // more expected cycles than actual
+            return false;
         }
 
-        const cycle_t expected{ expected_cycle };
-        const auto& actual = actual_cycles[actual_idx++];
+    } else {
 
-        const auto expected_address = expected.address();
-        const auto actual_address = std::get<0>(actual);
-        check("Cycle address", expected_address, actual_address);
+        size_t actual_idx = 0;
+        for (const auto expected_cycle : expected_cycles) {
 
-        const auto expected_value = expected.value();
-        const auto actual_value = std::get<1>(actual);
-        check("Cycle value", expected_value, actual_value);
+            if (actual_idx >= actual_cycles.size()) {
+                m_cycle_count_mismatch = true;
+                return false; // more expected cycles than actual
+            }
 
-        const auto expected_action = expected.action();
-        const auto actual_action = std::get<2>(actual);
-        check("Cycle action", expected_action.value_unsafe(), actual_action);
-    }
+            const cycle_t expected{ expected_cycle };
+            const auto& actual = actual_cycles[actual_idx++];
+
+            const auto expected_address = expected.address();
+            const auto actual_address = std::get<0>(actual);
+            check("Cycle address", expected_address, actual_address);
 
-    if (actual_idx < actual_cycles.size()) {
-        m_cycle_count_mismatch = true;
-        return false; // less expected cycles than actual
+            const auto expected_value = expected.value();
+            const auto actual_value = std::get<1>(actual);
+            check("Cycle value", expected_value, actual_value);
+
+            const auto expected_action = expected.action();
+            const auto actual_action = std::get<2>(actual);
+            check("Cycle action", expected_action.value_unsafe(), actual_action);
+        }
+
+        if (actual_idx < actual_cycles.size()) {
+            m_cycle_count_mismatch = true;
+            return false; // less expected cycles than actual
+        }
     }
 
     if (!m_messages.empty())
@@ -10,7 +10,7 @@
 #include "opcode_test_suite_t.h"
 #include "processor_test_suite_t.h"
 
-int main() {
+int main(int argc, char* argv[]) {
 
     auto directory = std::string("C:\\github\\spectrum\\libraries\\EightBit\\modules\\65x02\\6502\\v1");
 
@@ -19,7 +19,10 @@ int main() {
     int unimplemented_opcode_count = 0;
     int invalid_opcode_count = 0;
 
-    TestRunner runner;
+    // "--translated" runs the tests through the x86-64 translator
+    const auto translated = (argc > 1) && (std::string(argv[1]) == "--translated");
+
+    TestRunner runner(translated);
     runner.initialise();
 
     checker_t checker(runner);
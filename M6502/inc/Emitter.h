@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace EightBit {
+
+	// Writes x86-64 machine code into a caller supplied buffer.  Only the handful
+	// of encodings the translator needs are here.  Running out of room isn't an
+	// error until the code is used: "overflowed" says whether it all fitted.
+	class Emitter final {
+	public:
+		enum reg_t {
+			RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+			R8, R9, R10, R11, R12, R13, R14, R15,
+		};
+
+		enum condition_t {
+			O = 0x0, NO = 0x1, C = 0x2, NC = 0x3, Z = 0x4, NZ = 0x5, BE = 0x6, A = 0x7,
+			S = 0x8, NS = 0x9,
+		};
+
+		// Group one arithmetic, by ModRM extension
+		enum arithmetic_t { ADD = 0, OR = 1, ADC = 2, SBB = 3, AND = 4, SUB = 5, XOR = 6, CMP = 7 };
+
+		// Group two shifts and rotates, by ModRM extension
+		enum shift_t { ROL = 0, ROR = 1, RCL = 2, RCR = 3, SHL = 4, SHR = 5 };
+
+		typedef size_t label_t;		// The position of a rel32 waiting to be bound
+
+		Emitter(uint8_t* code, size_t size) noexcept;
+
+		[[nodiscard]] constexpr auto position() const noexcept { return m_position; }
+		[[nodiscard]] constexpr auto overflowed() const noexcept { return m_position > m_size; }
+		[[nodiscard]] constexpr auto code() const noexcept { return m_code; }
+
+		// Register to register
+		void arithmetic8(arithmetic_t operation, reg_t destination, reg_t source) noexcept;
+		void arithmetic32(arithmetic_t operation, reg_t destination, reg_t source) noexcept;
+		void mov8(reg_t destination, reg_t source) noexcept;
+		void mov32(reg_t destination, reg_t source) noexcept;
+		void mov64(reg_t destination, reg_t source) noexcept;
+		void movzx8(reg_t destination, reg_t source) noexcept;
+		void movzx16(reg_t destination, reg_t source) noexcept;
+		void test8(reg_t destination, reg_t source) noexcept;
+		void test64(reg_t destination, reg_t source) noexcept;
+
+		// Register and immediate
+		void arithmetic8(arithmetic_t operation, reg_t destination, uint8_t immediate) noexcept;
+		void arithmetic32(arithmetic_t operation, reg_t destination, int32_t immediate) noexcept;
+		void mov8(reg_t destination, uint8_t immediate) noexcept;
+		void mov32(reg_t destination, uint32_t immediate) noexcept;
+		void test8(reg_t destination, uint8_t immediate) noexcept;
+		void shift8(shift_t operation, reg_t destination, uint8_t count = 1) noexcept;
+		void shift32(shift_t operation, reg_t destination, uint8_t count) noexcept;
+		void inc8(reg_t destination) noexcept;
+		void dec8(reg_t destination) noexcept;
+		void bt32(reg_t destination, uint8_t bit) noexcept;
+		void set(condition_t condition, reg_t destination) noexcept;
+		void cmc() noexcept;
+
+		// Register and memory, at "base + displacement"
+		void load8(reg_t destination, reg_t base, int32_t displacement) noexcept;
+		void load64(reg_t destination, reg_t base, int32_t displacement) noexcept;
+		void movzx8(reg_t destination, reg_t base, int32_t displacement) noexcept;
+		void store8(reg_t base, int32_t displacement, reg_t source) noexcept;
+		void store8(reg_t base, int32_t displacement, uint8_t immediate) noexcept;
+		void store16(reg_t base, int32_t displacement, reg_t source) noexcept;
+		void store16(reg_t base, int32_t displacement, uint16_t immediate) noexcept;
+		void store32(reg_t base, int32_t displacement, reg_t source) noexcept;
+
+		// Register and memory, at "base + index" (times eight for "load64")
+		void arithmetic8(arithmetic_t operation, reg_t destination, reg_t base, reg_t index) noexcept;
+		void load8(reg_t destination, reg_t base, reg_t index) noexcept;
+		void load64(reg_t destination, reg_t base, reg_t index) noexcept;
+		void movzx8(reg_t destination, reg_t base, reg_t index) noexcept;
+		void store8(reg_t base, reg_t index, reg_t source) noexcept;
+		void store8(reg_t base, reg_t index, uint8_t immediate) noexcept;
+
+		void push(reg_t source) noexcept;
+		void pop(reg_t destination) noexcept;
+		void ret() noexcept;
+
+		// Forward branches, bound once the target is known
+		[[nodiscard]] label_t jump() noexcept;
+		[[nodiscard]] label_t jump(condition_t condition) noexcept;
+		void bind(label_t label) noexcept;
+
+	private:
+		uint8_t* m_code;
+		size_t m_size;
+		size_t m_position = 0;
+
+		void byte(uint8_t value) noexcept;
+		void word(uint16_t value) noexcept;
+		void dword(uint32_t value) noexcept;
+
+		// SPL, BPL, SIL and DIL are only reachable with a REX prefix
+		[[nodiscard]] static constexpr bool uniform(const reg_t reg) noexcept { return reg >= RSP && reg <= RDI; }
+
+		void rex(bool wide, int reg, int index, int base, bool force = false) noexcept;
+		void direct(int reg, int rm) noexcept;
+		void displaced(int reg, reg_t base, int32_t displacement) noexcept;
+		void indexed(int reg, reg_t base, reg_t index, int scale) noexcept;
+
+		// Byte sized register to register, "opcode reg, rm"
+		void byteRegisters(uint8_t opcode, int reg, reg_t rm, bool uniformReg) noexcept;
+	};
+}
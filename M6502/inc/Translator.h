@@ -0,0 +1,203 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Register.h>
+#include <Signal.h>
+
+#include "Emitter.h"
+
+namespace EightBit {
+
+	class Bus;
+	class MOS6502;
+
+	// Translates hot runs of documented 6502 instructions (up to and including the
+	// next jump, call or return, and never past the end of a page) into x86-64 code.
+	// Taken branches leave the block.  A translated block runs as a single step,
+	// counting exactly the cycles its instructions would have taken.  Anything the
+	// generated code can't do itself, such as touching a page outside the page table,
+	// or decimal arithmetic, leaves the block at the start of that instruction, for
+	// the interpreter to take over.
+	class Translator final {
+	public:
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__linux__) || defined(_WIN32))
+		static constexpr bool Supported = true;
+#else
+		static constexpr bool Supported = false;
+#endif
+
+		static constexpr size_t DefaultLimit = 64;			// Instructions per block
+		static constexpr uint16_t DefaultThreshold = 16;	// Runs before translation
+
+		Translator(MOS6502& cpu, Bus& bus, size_t limit = DefaultLimit, uint16_t threshold = DefaultThreshold);
+		~Translator() noexcept;
+
+		Translator(const Translator&) = delete;
+		Translator& operator=(const Translator&) = delete;
+
+		// Runs the block at PC as the current step, if it's hot, translatable and
+		// would finish before the scheduler needs the clock.  False if the step is
+		// left to the interpreter.
+		[[nodiscard]] bool run() noexcept;
+
+		void flush() noexcept;
+
+		[[nodiscard]] size_t footprint() const noexcept;
+
+	private:
+		// Shared with the generated code, so laid out for it
+		struct context_t {
+			const uint8_t* const* reads = nullptr;
+			uint8_t* const* writes = nullptr;
+			const uint8_t* nz = nullptr;
+			uint32_t cycles = 0;
+			uint16_t pc = 0;
+			uint8_t a = 0;
+			uint8_t x = 0;
+			uint8_t y = 0;
+			uint8_t s = 0;
+			uint8_t p = 0;
+			uint8_t exited = 0;		// Left early: the instruction at "pc" is for the interpreter
+		};
+
+		typedef void (*entry_t)(context_t*);
+
+		struct block_t {
+			entry_t entry = nullptr;
+			uint16_t heat = 0;		// Runs so far, until translated
+			uint16_t maximum = 0;	// Cycles, if every page is crossed and the branch taken
+		};
+
+		struct page_t {
+			const uint8_t* storage = nullptr;
+			bool aliased = false;			// Also visible through another page, so never translated
+			std::bitset<0x100> covered;		// Bytes read by the translations of this page
+			std::array<block_t, 0x100> blocks;
+		};
+
+		enum operation_t {
+			XXX,
+			ADC, AND, ASL, BCC, BCS, BEQ, BIT, BMI, BNE, BPL, BVC, BVS, CLC, CLD, CLI, CLV,
+			CMP, CPX, CPY, DEC, DEX, DEY, EOR, INC, INX, INY, JMP, JSR, LDA, LDX, LDY,
+			LSR, NOP, ORA, PHA, PHP, PLA, PLP, ROL, ROR, RTI, RTS, SBC, SEC, SED, SEI,
+			STA, STX, STY, TAX, TAY, TSX, TXA, TXS, TYA,
+		};
+
+		enum addressing_t { IMP, ACC, IMM, ZP, ZPX, ZPY, ABS, ABX, ABY, IZX, IZY, IND, REL };
+
+		struct instruction_t {
+			operation_t operation = XXX;
+			addressing_t addressing = IMP;
+		};
+
+		// The "exit" an instruction takes, if it can't complete
+		struct side_t {
+			std::vector<Emitter::label_t> from;
+			uint16_t address = 0;
+			int cycles = 0;
+		};
+
+		static constexpr uint16_t Untranslatable = 0xffff;
+		static constexpr size_t ArenaSize = 0x100000;
+
+		static const std::array<uint8_t, 0x100> m_nz;
+
+		// Host registers, for as long as a block runs
+		static constexpr auto Context = Emitter::RBX;
+		static constexpr auto NZ = Emitter::RBP;		// Flags for each result
+		static constexpr auto S = Emitter::RSI;
+		static constexpr auto Cycles = Emitter::RDI;
+		static constexpr auto A = Emitter::R8;
+		static constexpr auto X = Emitter::R9;
+		static constexpr auto Y = Emitter::R10;
+		static constexpr auto P = Emitter::R11;
+		static constexpr auto Reads = Emitter::R12;
+		static constexpr auto Writes = Emitter::R13;
+		static constexpr auto Penalty = Emitter::R14;	// A page has been crossed
+		static constexpr auto Page = Emitter::R15;		// Host storage, or a spare byte
+
+		MOS6502& m_cpu;
+		Bus& m_bus;
+		size_t m_limit;
+		uint16_t m_threshold;
+
+		std::array<std::unique_ptr<page_t>, 0x100> m_pages;
+		ScopedConnection m_invalidation;
+		bool m_interpret = false;	// The last block left early
+
+		uint8_t* m_arena = nullptr;	// Read and execute, except while code is being emitted
+		size_t m_used = 0;
+
+		// Only while translating
+		Emitter* m_emitter = nullptr;
+		std::vector<side_t> m_sides;
+		std::vector<Emitter::label_t> m_exits;
+		int m_cycles = 0;			// Base cycles of the instructions so far
+
+		void release() noexcept;
+		[[nodiscard]] bool protect(bool writable) noexcept;
+
+		[[nodiscard]] block_t* lookup(register16_t pc) noexcept;
+		[[nodiscard]] bool aliased(uint8_t page) const noexcept;
+		void invalidate(register16_t address) noexcept;
+		static void reset(page_t& page) noexcept;
+
+		[[nodiscard]] static instruction_t decode(uint8_t opcode) noexcept;
+		[[nodiscard]] static int length(addressing_t addressing) noexcept;
+		[[nodiscard]] static bool penalised(instruction_t instruction) noexcept;
+
+		[[nodiscard]] bool translate(register16_t pc, page_t& page, block_t& block) noexcept;
+		void translate(instruction_t instruction, uint16_t at, const uint8_t* bytes) noexcept;
+
+		#pragma region Code generation
+
+		[[nodiscard]] constexpr auto& emitter() noexcept { return *m_emitter; }
+
+		void prologue() noexcept;
+		void epilogue() noexcept;
+
+		// Leaves the block at a known address, or the one in EDX
+		void leave(uint16_t address, int cycles) noexcept;
+		void leave(int cycles) noexcept;
+
+		// Leaves the block for the interpreter, if the condition holds
+		void side(Emitter::condition_t condition = Emitter::Z) noexcept;
+		void sides() noexcept;
+
+		void adjustNZ(Emitter::reg_t reg) noexcept;
+		void adjustCarry(Emitter::condition_t condition, Emitter::reg_t scratch = Emitter::RCX) noexcept;
+		void penalise() noexcept;
+
+		// Host storage of a page into RAX (or another register) or a side exit
+		void readable(uint8_t page, Emitter::reg_t into = Emitter::RAX) noexcept;
+		void readable(Emitter::reg_t page, Emitter::reg_t into = Emitter::RAX) noexcept;
+		void writable(uint8_t page, Emitter::reg_t into = Emitter::RAX) noexcept;
+		void writable(Emitter::reg_t page, Emitter::reg_t into = Emitter::RAX) noexcept;
+
+		// The effective address, either known or in EDX
+		struct operand_t {
+			bool known = false;
+			uint16_t address = 0;
+		};
+
+		[[nodiscard]] operand_t address(instruction_t instruction, const uint8_t* bytes, bool reading) noexcept;
+		void read(operand_t operand) noexcept;		// Into AL
+		void load(instruction_t instruction, const uint8_t* bytes) noexcept;	// Into AL, even if immediate
+		void write(operand_t operand, Emitter::reg_t source) noexcept;
+		void modify(instruction_t instruction, operand_t operand) noexcept;
+
+		void arithmetic(operation_t operation) noexcept;	// Operand in AL
+		void compare(Emitter::reg_t reg) noexcept;
+		void shift(operation_t operation, Emitter::reg_t reg) noexcept;
+		void branch(operation_t operation, uint16_t next, int8_t displacement) noexcept;
+		void pull(Emitter::reg_t into) noexcept;	// From the stack page in RAX
+
+		#pragma endregion
+	};
+}
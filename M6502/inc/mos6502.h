@@ -1,6 +1,8 @@
 ﻿#pragma once
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <utility>
 
 #include <LittleEndianProcessor.h>
@@ -8,10 +10,18 @@
 #include <Signal.h>
 #include <EventArgs.h>
 
+#include "Translator.h"
+
 namespace EightBit {
 
 	class Bus;
 
+	// Compile time policies for the members of the family.  The instruction set is
+	// built once for each, so the differences between them inline away.  Others (the
+	// 65C02, say) would add their own.
+	struct NMOS final { static constexpr bool Decimal = true; };	// The MOS 6502 itself
+	struct Ricoh final { static constexpr bool Decimal = false; };	// The 2A03 and 2A07: D is kept, but ignored
+
 	class MOS6502 : public LittleEndianProcessor {
 	private:
 		using base = LittleEndianProcessor;
@@ -49,9 +59,17 @@ namespace EightBit {
 			CF = Bit0,	// Carry
 		};
 
-		MOS6502(Bus& bus) noexcept;
+		// Fast mode keeps instruction timing exact, counting each instruction's cycles
+		// from a table, but makes only the bus accesses that could have an effect:
+		// dummy reads and writes are dropped, unless they fall on an I/O page (or any
+		// other page outside the page table), and the SYNC and RW pins are left alone.
+		// Interrupt sequences, and any instruction with something watching the bus or
+		// the clock, are always exact.
+		enum class mode_t { Exact, Fast };
 
-		void execute() noexcept final;
+		MOS6502(Bus& bus, mode_t mode = mode_t::Exact) noexcept;
+
+		void execute() noexcept final;	// As this class's variant
 		void poweredStep() noexcept final;
 
 		[[nodiscard]] constexpr auto& X() noexcept { return m_x; }
@@ -62,23 +80,85 @@ namespace EightBit {
 		[[nodiscard]] constexpr auto& P() noexcept { return m_p; }
 		[[nodiscard]] constexpr const auto& P() const noexcept { return m_p; }
 
+		[[nodiscard]] constexpr auto& mode() noexcept { return m_mode; }
+
+		// An optional translator of hot code into host (x86-64) code, for Fast mode.
+		// While nothing is watching instructions or the bus, a single step runs a whole
+		// translated block.  Pages holding translated code are watched on the bus, so
+		// writing to them invalidates the translations.  Memory changed around the bus
+		// (with "poke", say), or remapped to be visible through more than one page,
+		// needs a "flush".  Ignored where the host can't run translations.  Blocks
+		// are translated once run "threshold" times, and hold up to "limit" instructions.
+		void translate(bool enabled, size_t limit = Translator::DefaultLimit, uint16_t threshold = Translator::DefaultThreshold);
+		[[nodiscard]] auto translating() const noexcept { return m_translator != nullptr; }
+		void flush() noexcept;
+
+		[[nodiscard]] size_t footprint() const noexcept;
+
 	protected:
 		void handleRESET() noexcept final;
 		void handleINT() noexcept final;
 
+		[[nodiscard]] bool spinning() noexcept final;
+
 		void memoryWrite() noexcept final;
 		void memoryRead() noexcept final;
 
 		void getPagedInto(uint8_t page, uint8_t offset, register16_t& into) { Processor::getPagedInto(page, offset, into); }
 
+		// Runs the current instruction as the variant would.  Built for "NMOS" and "Ricoh".
+		template<class Variant> void dispatch() noexcept;
+
 	private:
+		friend class Translator;
+
 		const uint8_t _vectorIRQ = 0xfe;		// IRQ vector
 		const uint8_t _vectorRST = 0xfc;		// RST vector
 		const uint8_t _vectorNMI = 0xfa;		// NMI vector
 
+		mode_t m_mode = mode_t::Exact;
+		bool m_quiet = false;		// Fast, and nothing is watching the bus, for the current instruction
+
+		std::unique_ptr<Translator> m_translator;
+		bool m_translated = false;	// The current step ran a translated block
+
+		// Documented cycle counts, for instructions that neither cross a page nor take a branch
+		static const std::array<uint8_t, 0x100> m_instructionCycles;
+
 		void handleNMI() noexcept;
 		void handleSO() noexcept;
 
+		[[nodiscard]] bool interrupting() noexcept;
+		[[nodiscard]] bool observed() noexcept;
+
+		// Each class of processor dispatches as its own variant, however the instruction is run
+		virtual void dispatchVariant() noexcept;
+
+		template<class Variant, bool Threaded> void interpret() noexcept;
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+		bool m_threading = false;	// Quiet, and nothing is watching instructions, for the current step
+		bool m_threaded = false;	// More than one instruction was run by the current step
+
+		[[nodiscard]] bool proceed() noexcept;
+
+		// Branches, jumps, calls, returns, BRK and JAM
+		[[nodiscard]] static constexpr bool ends(const uint8_t opcode) noexcept {
+			switch (opcode) {
+			case 0x00: case 0x20: case 0x40: case 0x60:		// BRK, JSR, RTI, RTS
+			case 0x4c: case 0x6c:							// JMP
+			case 0x10: case 0x30: case 0x50: case 0x70:		// Bxx
+			case 0x90: case 0xb0: case 0xd0: case 0xf0:
+			case 0x02: case 0x12: case 0x22: case 0x32:		// *JAM
+			case 0x42: case 0x52: case 0x62: case 0x72:
+			case 0x92: case 0xb2: case 0xd2: case 0xf2:
+				return true;
+			default:
+				return false;
+			}
+		}
+#endif
+
 		void adjustInterruptFlags();
 
 		void reset();
@@ -101,6 +181,10 @@ namespace EightBit {
 
 		void modifyWrite(uint8_t data) noexcept;
 
+		// Only made if they could be seen
+		void dummyRead() noexcept;
+		void dummyWrite() noexcept;
+
 		// Read the opcode within the existing cycle
 		[[nodiscard]] uint8_t fetchInstruction() noexcept final;
 
@@ -285,6 +369,20 @@ namespace EightBit {
 
 		#pragma region Instructions with BCD effects
 
+		#pragma region Decimal digits
+
+		// Each decimal digit of an addition or subtraction is worked out at compile time,
+		// indexed by the carry (or borrow) in and the two digits.  Entries hold the adjusted
+		// digit, with the carry (or borrow) out in bit 4.  Additions also keep bit 3 of the
+		// unadjusted digit in bit 7, since that's where N and V come from.
+		[[nodiscard]] static constexpr auto decimalIndex(const int carry, const int first, const int second) noexcept { return (carry << 8) | (first << 4) | second; }
+		[[nodiscard]] static constexpr uint8_t decimalAdd(int first, int second, int carry) noexcept;
+		[[nodiscard]] static constexpr uint8_t decimalSubtract(int first, int second, int borrow) noexcept;
+		static const std::array<uint8_t, 0x200> m_decimalAddition;
+		static const std::array<uint8_t, 0x200> m_decimalSubtraction;
+
+		#pragma endregion
+
 		#pragma region Addition / subtraction
 
 		#pragma region Subtraction
@@ -295,14 +393,17 @@ namespace EightBit {
 			setFlag(VF, negativeTest((operand ^ data) & (operand ^ result)));
 		}
 
-		constexpr void SBC() noexcept {
+		template<class Variant> constexpr void SBC() noexcept {
 			const auto operand = A();
-			A() = SUB(operand, carryTest(~P()));
+			A() = SUB<Variant>(operand, carryTest(~P()));
 			PostSUB(operand);
 		}
 
-		constexpr uint8_t SUB(uint8_t operand, int borrow) noexcept {
-			return denary() != 0 ? decimalSUB(operand, borrow) : binarySUB(operand, borrow);
+		template<class Variant> constexpr uint8_t SUB(uint8_t operand, int borrow) noexcept {
+			if constexpr (Variant::Decimal)
+				return denary() != 0 ? decimalSUB(operand, borrow) : binarySUB(operand, borrow);
+			else
+				return binarySUB(operand, borrow);
 		}
 
 		constexpr uint8_t binarySUB(uint8_t operand, int borrow = 0) noexcept {
@@ -315,20 +416,14 @@ namespace EightBit {
 			return result;
 		}
 
+		// Only the result is decimal: the flags are those of the binary subtraction
 		constexpr uint8_t decimalSUB(uint8_t operand, int borrow) noexcept {
 
 			binarySUB(operand, borrow);
 
 			const auto data = BUS().DATA();
-			auto low = lowNibble(operand) - lowNibble(data) - borrow;
-			const auto lowNegative = negativeTest(low);
-			if (lowNegative != 0)
-				low -= 6;
-
-			auto high = highNibble(operand) - highNibble(data) - (lowNegative >> 7);
-			const auto highNegative = negativeTest(high);
-			if (highNegative != 0)
-				high -= 6;
+			const auto low = m_decimalSubtraction[decimalIndex(borrow, lowNibble(operand), lowNibble(data))];
+			const auto high = m_decimalSubtraction[decimalIndex(carryTest(low >> 4), highNibble(operand), highNibble(data))];
 
 			return promoteNibble(high) | lowNibble(low);
 		}
@@ -348,9 +443,14 @@ namespace EightBit {
 			setFlag(VF, negativeTest(~(operand ^ data) & (operand ^ result)));
 		}
 
-		constexpr void ADC() noexcept { ADC(BUS().DATA()); }
+		template<class Variant> constexpr void ADC() noexcept { ADC<Variant>(BUS().DATA()); }
 
-		constexpr void ADC(uint8_t data) noexcept { A() = denary() != 0 ? decimalADC(data) : binaryADC(data); }
+		template<class Variant> constexpr void ADC(uint8_t data) noexcept {
+			if constexpr (Variant::Decimal)
+				A() = denary() != 0 ? decimalADC(data) : binaryADC(data);
+			else
+				A() = binaryADC(data);
+		}
 
 		[[nodiscard]] constexpr uint8_t binaryADC(uint8_t data) noexcept {
 			const auto operand = A();
@@ -364,30 +464,21 @@ namespace EightBit {
 			return result;
 		}
 
+		// Z is that of the binary sum.  N and V are taken before the high digit is adjusted.
 		[[nodiscard]] constexpr uint8_t decimalADC(uint8_t data) noexcept {
 
 			const auto operand = A();
+			const auto carrying = carry();
 
-			auto low = (uint16_t)(lowerNibble(operand) + lowerNibble(data) + carry());
-			intermediate() = higherNibble(operand) + higherNibble(data);
+			const auto low = m_decimalAddition[decimalIndex(carrying, lowNibble(operand), lowNibble(data))];
+			const auto high = m_decimalAddition[decimalIndex(carryTest(low >> 4), highNibble(operand), highNibble(data))];
 
-			adjustZero(lowByte((uint16_t)(low + intermediate().joined)));
+			adjustZero(lowByte(operand + data + carrying));
+			adjustNegative(high);
+			setFlag(VF, negativeTest(~(operand ^ data) & (operand ^ high)));
+			setFlag(CF, high & Bit4);
 
-			if (low > 0x09)
-			{
-				intermediate() += 0x10;
-				low += 0x06;
-			}
-
-			adjustNegative(intermediate().low);
-			adjustOverflowAdd(operand);
-
-			if (intermediate().joined > 0x90)
-				intermediate() += 0x60;
-
-			setFlag(CF, intermediate().high);
-
-			return (uint8_t)(lowerNibble(lowByte((uint16_t)(low + intermediate().joined))) | higherNibble(intermediate().low));
+			return promoteNibble(high) | lowNibble(low);
 		}
 
 		#pragma endregion
@@ -506,7 +597,7 @@ namespace EightBit {
 
 		#pragma region Undocumented instructions with BCD effects
 
-		void ARR();
+		template<class Variant> void ARR();
 		uint8_t coreARR();
 		void decimalARR();
 		void binaryARR();
@@ -533,9 +624,9 @@ namespace EightBit {
 		void ANE();
 		void ATX();
 		void ASR();
-		void ISB();
+		template<class Variant> void ISB();
 		void RLA();
-		void RRA();
+		template<class Variant> void RRA();
 		void SLO();
 		void SRE();
 		void DCP();
@@ -0,0 +1,310 @@
+#include "stdafx.h"
+#include "../inc/Emitter.h"
+
+EightBit::Emitter::Emitter(uint8_t* const code, const size_t size) noexcept
+: m_code(code),
+  m_size(size) {}
+
+void EightBit::Emitter::byte(const uint8_t value) noexcept {
+	if (m_position < m_size)
+		m_code[m_position] = value;
+	++m_position;
+}
+
+void EightBit::Emitter::word(const uint16_t value) noexcept {
+	byte(value & 0xff);
+	byte(value >> 8);
+}
+
+void EightBit::Emitter::dword(const uint32_t value) noexcept {
+	word(value & 0xffff);
+	word(value >> 16);
+}
+
+void EightBit::Emitter::rex(const bool wide, const int reg, const int index, const int base, const bool force) noexcept {
+	const uint8_t value = 0x40 | (wide << 3) | ((reg & 8) >> 1) | ((index & 8) >> 2) | ((base & 8) >> 3);
+	if (value != 0x40 || force)
+		byte(value);
+}
+
+void EightBit::Emitter::direct(const int reg, const int rm) noexcept {
+	byte(0xc0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+void EightBit::Emitter::displaced(const int reg, const reg_t base, const int32_t displacement) noexcept {
+	const auto rm = base & 7;
+	const auto small = displacement >= -128 && displacement <= 127;
+	const auto mod = (displacement == 0 && rm != RBP) ? 0 : small ? 1 : 2;
+	byte((mod << 6) | ((reg & 7) << 3) | rm);
+	if (rm == RSP)
+		byte(0x24);
+	if (mod == 1)
+		byte(displacement & 0xff);
+	else if (mod == 2)
+		dword(displacement);
+}
+
+void EightBit::Emitter::indexed(const int reg, const reg_t base, const reg_t index, const int scale) noexcept {
+	const auto mod = (base & 7) == RBP ? 1 : 0;
+	byte((mod << 6) | ((reg & 7) << 3) | RSP);
+	byte((scale << 6) | ((index & 7) << 3) | (base & 7));
+	if (mod == 1)
+		byte(0);
+}
+
+void EightBit::Emitter::byteRegisters(const uint8_t opcode, const int reg, const reg_t rm, const bool uniformReg) noexcept {
+	rex(false, reg, 0, rm, uniformReg || uniform(rm));
+	byte(opcode);
+	direct(reg, rm);
+}
+
+void EightBit::Emitter::arithmetic8(const arithmetic_t operation, const reg_t destination, const reg_t source) noexcept {
+	byteRegisters(operation << 3, source, destination, uniform(source));
+}
+
+void EightBit::Emitter::arithmetic32(const arithmetic_t operation, const reg_t destination, const reg_t source) noexcept {
+	rex(false, source, 0, destination);
+	byte((operation << 3) | 1);
+	direct(source, destination);
+}
+
+void EightBit::Emitter::mov8(const reg_t destination, const reg_t source) noexcept {
+	byteRegisters(0x88, source, destination, uniform(source));
+}
+
+void EightBit::Emitter::mov32(const reg_t destination, const reg_t source) noexcept {
+	rex(false, source, 0, destination);
+	byte(0x89);
+	direct(source, destination);
+}
+
+void EightBit::Emitter::mov64(const reg_t destination, const reg_t source) noexcept {
+	rex(true, source, 0, destination);
+	byte(0x89);
+	direct(source, destination);
+}
+
+void EightBit::Emitter::movzx8(const reg_t destination, const reg_t source) noexcept {
+	rex(false, destination, 0, source, uniform(source));
+	byte(0x0f);
+	byte(0xb6);
+	direct(destination, source);
+}
+
+void EightBit::Emitter::movzx16(const reg_t destination, const reg_t source) noexcept {
+	rex(false, destination, 0, source);
+	byte(0x0f);
+	byte(0xb7);
+	direct(destination, source);
+}
+
+void EightBit::Emitter::test8(const reg_t destination, const reg_t source) noexcept {
+	byteRegisters(0x84, source, destination, uniform(source));
+}
+
+void EightBit::Emitter::test64(const reg_t destination, const reg_t source) noexcept {
+	rex(true, source, 0, destination);
+	byte(0x85);
+	direct(source, destination);
+}
+
+void EightBit::Emitter::arithmetic8(const arithmetic_t operation, const reg_t destination, const uint8_t immediate) noexcept {
+	byteRegisters(0x80, operation, destination, false);
+	byte(immediate);
+}
+
+void EightBit::Emitter::arithmetic32(const arithmetic_t operation, const reg_t destination, const int32_t immediate) noexcept {
+	rex(false, 0, 0, destination);
+	const auto small = immediate >= -128 && immediate <= 127;
+	byte(small ? 0x83 : 0x81);
+	direct(operation, destination);
+	if (small)
+		byte(immediate & 0xff);
+	else
+		dword(immediate);
+}
+
+void EightBit::Emitter::mov8(const reg_t destination, const uint8_t immediate) noexcept {
+	rex(false, 0, 0, destination, uniform(destination));
+	byte(0xb0 | (destination & 7));
+	byte(immediate);
+}
+
+void EightBit::Emitter::mov32(const reg_t destination, const uint32_t immediate) noexcept {
+	rex(false, 0, 0, destination);
+	byte(0xb8 | (destination & 7));
+	dword(immediate);
+}
+
+void EightBit::Emitter::test8(const reg_t destination, const uint8_t immediate) noexcept {
+	byteRegisters(0xf6, 0, destination, false);
+	byte(immediate);
+}
+
+void EightBit::Emitter::shift8(const shift_t operation, const reg_t destination, const uint8_t count) noexcept {
+	byteRegisters(count == 1 ? 0xd0 : 0xc0, operation, destination, false);
+	if (count != 1)
+		byte(count);
+}
+
+void EightBit::Emitter::shift32(const shift_t operation, const reg_t destination, const uint8_t count) noexcept {
+	rex(false, 0, 0, destination);
+	byte(0xc1);
+	direct(operation, destination);
+	byte(count);
+}
+
+void EightBit::Emitter::inc8(const reg_t destination) noexcept {
+	byteRegisters(0xfe, 0, destination, false);
+}
+
+void EightBit::Emitter::dec8(const reg_t destination) noexcept {
+	byteRegisters(0xfe, 1, destination, false);
+}
+
+void EightBit::Emitter::bt32(const reg_t destination, const uint8_t bit) noexcept {
+	rex(false, 0, 0, destination);
+	byte(0x0f);
+	byte(0xba);
+	direct(4, destination);
+	byte(bit);
+}
+
+void EightBit::Emitter::set(const condition_t condition, const reg_t destination) noexcept {
+	rex(false, 0, 0, destination, uniform(destination));
+	byte(0x0f);
+	byte(0x90 | condition);
+	direct(0, destination);
+}
+
+void EightBit::Emitter::cmc() noexcept {
+	byte(0xf5);
+}
+
+void EightBit::Emitter::load8(const reg_t destination, const reg_t base, const int32_t displacement) noexcept {
+	rex(false, destination, 0, base, uniform(destination));
+	byte(0x8a);
+	displaced(destination, base, displacement);
+}
+
+void EightBit::Emitter::load64(const reg_t destination, const reg_t base, const int32_t displacement) noexcept {
+	rex(true, destination, 0, base);
+	byte(0x8b);
+	displaced(destination, base, displacement);
+}
+
+void EightBit::Emitter::movzx8(const reg_t destination, const reg_t base, const int32_t displacement) noexcept {
+	rex(false, destination, 0, base);
+	byte(0x0f);
+	byte(0xb6);
+	displaced(destination, base, displacement);
+}
+
+void EightBit::Emitter::store8(const reg_t base, const int32_t displacement, const reg_t source) noexcept {
+	rex(false, source, 0, base, uniform(source));
+	byte(0x88);
+	displaced(source, base, displacement);
+}
+
+void EightBit::Emitter::store8(const reg_t base, const int32_t displacement, const uint8_t immediate) noexcept {
+	rex(false, 0, 0, base);
+	byte(0xc6);
+	displaced(0, base, displacement);
+	byte(immediate);
+}
+
+void EightBit::Emitter::store16(const reg_t base, const int32_t displacement, const reg_t source) noexcept {
+	byte(0x66);
+	rex(false, source, 0, base);
+	byte(0x89);
+	displaced(source, base, displacement);
+}
+
+void EightBit::Emitter::store16(const reg_t base, const int32_t displacement, const uint16_t immediate) noexcept {
+	byte(0x66);
+	rex(false, 0, 0, base);
+	byte(0xc7);
+	displaced(0, base, displacement);
+	word(immediate);
+}
+
+void EightBit::Emitter::store32(const reg_t base, const int32_t displacement, const reg_t source) noexcept {
+	rex(false, source, 0, base);
+	byte(0x89);
+	displaced(source, base, displacement);
+}
+
+void EightBit::Emitter::arithmetic8(const arithmetic_t operation, const reg_t destination, const reg_t base, const reg_t index) noexcept {
+	rex(false, destination, index, base, uniform(destination));
+	byte((operation << 3) | 2);
+	indexed(destination, base, index, 0);
+}
+
+void EightBit::Emitter::load8(const reg_t destination, const reg_t base, const reg_t index) noexcept {
+	rex(false, destination, index, base, uniform(destination));
+	byte(0x8a);
+	indexed(destination, base, index, 0);
+}
+
+void EightBit::Emitter::load64(const reg_t destination, const reg_t base, const reg_t index) noexcept {
+	rex(true, destination, index, base);
+	byte(0x8b);
+	indexed(destination, base, index, 3);
+}
+
+void EightBit::Emitter::movzx8(const reg_t destination, const reg_t base, const reg_t index) noexcept {
+	rex(false, destination, index, base);
+	byte(0x0f);
+	byte(0xb6);
+	indexed(destination, base, index, 0);
+}
+
+void EightBit::Emitter::store8(const reg_t base, const reg_t index, const reg_t source) noexcept {
+	rex(false, source, index, base, uniform(source));
+	byte(0x88);
+	indexed(source, base, index, 0);
+}
+
+void EightBit::Emitter::store8(const reg_t base, const reg_t index, const uint8_t immediate) noexcept {
+	rex(false, 0, index, base);
+	byte(0xc6);
+	indexed(0, base, index, 0);
+	byte(immediate);
+}
+
+void EightBit::Emitter::push(const reg_t source) noexcept {
+	rex(false, 0, 0, source);
+	byte(0x50 | (source & 7));
+}
+
+void EightBit::Emitter::pop(const reg_t destination) noexcept {
+	rex(false, 0, 0, destination);
+	byte(0x58 | (destination & 7));
+}
+
+void EightBit::Emitter::ret() noexcept {
+	byte(0xc3);
+}
+
+EightBit::Emitter::label_t EightBit::Emitter::jump() noexcept {
+	byte(0xe9);
+	const auto label = position();
+	dword(0);
+	return label;
+}
+
+EightBit::Emitter::label_t EightBit::Emitter::jump(const condition_t condition) noexcept {
+	byte(0x0f);
+	byte(0x80 | condition);
+	const auto label = position();
+	dword(0);
+	return label;
+}
+
+void EightBit::Emitter::bind(const label_t label) noexcept {
+	const auto relative = static_cast<uint32_t>(position() - (label + 4));
+	if (label + 4 > m_size)
+		return;
+	for (int i = 0; i < 4; ++i)
+		m_code[label + i] = (relative >> (i * 8)) & 0xff;
+}
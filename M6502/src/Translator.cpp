@@ -0,0 +1,904 @@
+#include "stdafx.h"
+#include "../inc/Translator.h"
+#include "../inc/mos6502.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include <Bus.h>
+
+#if defined(_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(__linux__)
+#	include <sys/mman.h>
+#endif
+
+// Negative and zero flags, for each possible result
+const std::array<uint8_t, 0x100> EightBit::Translator::m_nz = [] {
+	std::array<uint8_t, 0x100> flags = {};
+	for (int value = 0; value < 0x100; ++value)
+		flags[value] = (value & MOS6502::NF) | (value == 0 ? MOS6502::ZF : 0);
+	return flags;
+}();
+
+EightBit::Translator::Translator(MOS6502& cpu, Bus& bus, const size_t limit, const uint16_t threshold)
+: m_cpu(cpu),
+  m_bus(bus),
+  m_limit(limit),
+  m_threshold(std::min(threshold, uint16_t(Untranslatable - 1))) {
+#if defined(_WIN32)
+	m_arena = static_cast<uint8_t*>(::VirtualAlloc(nullptr, ArenaSize, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READ));
+#elif defined(__linux__)
+	auto* const arena = ::mmap(nullptr, ArenaSize, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	m_arena = arena == MAP_FAILED ? nullptr : static_cast<uint8_t*>(arena);
+#endif
+	m_invalidation = m_bus.WrittenWatchedPage.connect([this](const register16_t address) {
+		invalidate(address);
+	});
+}
+
+EightBit::Translator::~Translator() noexcept {
+	flush();
+	release();
+}
+
+bool EightBit::Translator::run() noexcept {
+
+	// The instruction that stopped the last block
+	if (m_interpret) {
+		m_interpret = false;
+		return false;
+	}
+
+	if (m_arena == nullptr)
+		return false;
+
+	const auto* const block = lookup(m_cpu.PC());
+	if (block == nullptr)
+		return false;
+
+	const auto& scheduler = m_bus.scheduler();
+	if (scheduler.now() + m_cpu.cycles() + block->maximum > scheduler.next())
+		return false;
+
+	context_t context;
+	context.reads = m_bus.readPages();
+	context.writes = m_bus.writePages();
+	context.nz = m_nz.data();
+	context.pc = m_cpu.PC().joined;
+	context.a = m_cpu.A();
+	context.x = m_cpu.X();
+	context.y = m_cpu.Y();
+	context.s = m_cpu.S();
+	context.p = m_cpu.P();
+
+	block->entry(&context);
+
+	// Stopped by its first instruction, so nothing has changed
+	if (context.exited && context.cycles == 0)
+		return false;
+
+	m_cpu.PC().joined = context.pc;
+	m_cpu.A() = context.a;
+	m_cpu.X() = context.x;
+	m_cpu.Y() = context.y;
+	m_cpu.S() = context.s;
+	m_cpu.P() = context.p;
+
+	m_interpret = context.exited;
+	m_cpu.tick(context.cycles - 1);		// The step has already counted one
+	return true;
+}
+
+void EightBit::Translator::flush() noexcept {
+	for (size_t page = 0; page < m_pages.size(); ++page) {
+		if (m_pages[page] != nullptr) {
+			m_bus.unwatch(static_cast<uint8_t>(page));
+			m_pages[page].reset();
+		}
+	}
+	m_used = 0;
+	m_interpret = false;
+}
+
+void EightBit::Translator::release() noexcept {
+	if (m_arena == nullptr)
+		return;
+#if defined(_WIN32)
+	::VirtualFree(m_arena, 0, MEM_RELEASE);
+#elif defined(__linux__)
+	::munmap(m_arena, ArenaSize);
+#endif
+	m_arena = nullptr;
+}
+
+// The arena is only writable while code is being emitted, and only executable otherwise
+bool EightBit::Translator::protect(const bool writable) noexcept {
+#if defined(_WIN32)
+	DWORD previous = 0;
+	if (!::VirtualProtect(m_arena, ArenaSize, writable ? PAGE_READWRITE : PAGE_EXECUTE_READ, &previous))
+		return false;
+	return writable || ::FlushInstructionCache(::GetCurrentProcess(), m_arena, ArenaSize);
+#elif defined(__linux__)
+	return ::mprotect(m_arena, ArenaSize, writable ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC) == 0;
+#else
+	return false;
+#endif
+}
+
+size_t EightBit::Translator::footprint() const noexcept {
+	const auto pages = std::count_if(m_pages.cbegin(), m_pages.cend(), [](const auto& page) { return page != nullptr; });
+	return (m_arena == nullptr ? 0 : ArenaSize) + pages * sizeof(page_t);
+}
+
+EightBit::Translator::block_t* EightBit::Translator::lookup(const register16_t pc) noexcept {
+
+	const auto* const storage = m_bus.readable(pc.high);
+	if (storage == nullptr)
+		return nullptr;
+
+	auto& page = m_pages[pc.high];
+	if (page == nullptr) {
+		page = std::make_unique<page_t>();
+		m_bus.watch(pc.high);
+	}
+
+	// Remapped, or bank switched
+	if (page->storage != storage) {
+		reset(*page);
+		page->storage = storage;
+		page->aliased = aliased(pc.high);
+	}
+
+	if (page->aliased)
+		return nullptr;
+
+	auto& block = page->blocks[pc.low];
+	if (block.entry == nullptr) {
+		if (block.heat == Untranslatable || ++block.heat < m_threshold)
+			return nullptr;
+		if (!protect(true))
+			return nullptr;
+		const auto translated = translate(pc, *page, block);
+		if (!protect(false)) {
+			flush();
+			release();		// Can't be run, so the interpreter takes over for good
+			return nullptr;
+		}
+		if (!translated)
+			return nullptr;		// Everything has been flushed, to make room
+		if (block.entry == nullptr)
+			return nullptr;
+	}
+	return &block;
+}
+
+// Writes through another page wouldn't be seen
+bool EightBit::Translator::aliased(const uint8_t page) const noexcept {
+	const auto* const storage = m_bus.readable(page);
+	for (int other = 0; other < 0x100; ++other) {
+		const auto* const candidate = m_bus.readable(other);
+		if ((other != page) && (candidate != nullptr) && (candidate < storage + 0x100) && (storage < candidate + 0x100))
+			return true;
+	}
+	return false;
+}
+
+void EightBit::Translator::invalidate(const register16_t address) noexcept {
+	auto& page = m_pages[address.high];
+	if ((page != nullptr) && page->covered[address.low])
+		reset(*page);
+}
+
+void EightBit::Translator::reset(page_t& page) noexcept {
+	page.covered.reset();
+	page.blocks.fill({});
+}
+
+EightBit::Translator::instruction_t EightBit::Translator::decode(const uint8_t opcode) noexcept {
+	switch (opcode) {
+	case 0x01: return { ORA, IZX };	case 0x05: return { ORA, ZP };	case 0x06: return { ASL, ZP };	case 0x08: return { PHP, IMP };
+	case 0x09: return { ORA, IMM };	case 0x0a: return { ASL, ACC };	case 0x0d: return { ORA, ABS };	case 0x0e: return { ASL, ABS };
+	case 0x10: return { BPL, REL };	case 0x11: return { ORA, IZY };	case 0x15: return { ORA, ZPX };	case 0x16: return { ASL, ZPX };
+	case 0x18: return { CLC, IMP };	case 0x19: return { ORA, ABY };	case 0x1d: return { ORA, ABX };	case 0x1e: return { ASL, ABX };
+	case 0x20: return { JSR, ABS };	case 0x21: return { AND, IZX };	case 0x24: return { BIT, ZP };	case 0x25: return { AND, ZP };
+	case 0x26: return { ROL, ZP };	case 0x28: return { PLP, IMP };	case 0x29: return { AND, IMM };	case 0x2a: return { ROL, ACC };
+	case 0x2c: return { BIT, ABS };	case 0x2d: return { AND, ABS };	case 0x2e: return { ROL, ABS };
+	case 0x30: return { BMI, REL };	case 0x31: return { AND, IZY };	case 0x35: return { AND, ZPX };	case 0x36: return { ROL, ZPX };
+	case 0x38: return { SEC, IMP };	case 0x39: return { AND, ABY };	case 0x3d: return { AND, ABX };	case 0x3e: return { ROL, ABX };
+	case 0x40: return { RTI, IMP };	case 0x41: return { EOR, IZX };	case 0x45: return { EOR, ZP };	case 0x46: return { LSR, ZP };
+	case 0x48: return { PHA, IMP };	case 0x49: return { EOR, IMM };	case 0x4a: return { LSR, ACC };	case 0x4c: return { JMP, ABS };
+	case 0x4d: return { EOR, ABS };	case 0x4e: return { LSR, ABS };
+	case 0x50: return { BVC, REL };	case 0x51: return { EOR, IZY };	case 0x55: return { EOR, ZPX };	case 0x56: return { LSR, ZPX };
+	case 0x58: return { CLI, IMP };	case 0x59: return { EOR, ABY };	case 0x5d: return { EOR, ABX };	case 0x5e: return { LSR, ABX };
+	case 0x60: return { RTS, IMP };	case 0x61: return { ADC, IZX };	case 0x65: return { ADC, ZP };	case 0x66: return { ROR, ZP };
+	case 0x68: return { PLA, IMP };	case 0x69: return { ADC, IMM };	case 0x6a: return { ROR, ACC };	case 0x6c: return { JMP, IND };
+	case 0x6d: return { ADC, ABS };	case 0x6e: return { ROR, ABS };
+	case 0x70: return { BVS, REL };	case 0x71: return { ADC, IZY };	case 0x75: return { ADC, ZPX };	case 0x76: return { ROR, ZPX };
+	case 0x78: return { SEI, IMP };	case 0x79: return { ADC, ABY };	case 0x7d: return { ADC, ABX };	case 0x7e: return { ROR, ABX };
+	case 0x81: return { STA, IZX };	case 0x84: return { STY, ZP };	case 0x85: return { STA, ZP };	case 0x86: return { STX, ZP };
+	case 0x88: return { DEY, IMP };	case 0x8a: return { TXA, IMP };	case 0x8c: return { STY, ABS };	case 0x8d: return { STA, ABS };
+	case 0x8e: return { STX, ABS };
+	case 0x90: return { BCC, REL };	case 0x91: return { STA, IZY };	case 0x94: return { STY, ZPX };	case 0x95: return { STA, ZPX };
+	case 0x96: return { STX, ZPY };	case 0x98: return { TYA, IMP };	case 0x99: return { STA, ABY };	case 0x9a: return { TXS, IMP };
+	case 0x9d: return { STA, ABX };
+	case 0xa0: return { LDY, IMM };	case 0xa1: return { LDA, IZX };	case 0xa2: return { LDX, IMM };	case 0xa4: return { LDY, ZP };
+	case 0xa5: return { LDA, ZP };	case 0xa6: return { LDX, ZP };	case 0xa8: return { TAY, IMP };	case 0xa9: return { LDA, IMM };
+	case 0xaa: return { TAX, IMP };	case 0xac: return { LDY, ABS };	case 0xad: return { LDA, ABS };	case 0xae: return { LDX, ABS };
+	case 0xb0: return { BCS, REL };	case 0xb1: return { LDA, IZY };	case 0xb4: return { LDY, ZPX };	case 0xb5: return { LDA, ZPX };
+	case 0xb6: return { LDX, ZPY };	case 0xb8: return { CLV, IMP };	case 0xb9: return { LDA, ABY };	case 0xba: return { TSX, IMP };
+	case 0xbc: return { LDY, ABX };	case 0xbd: return { LDA, ABX };	case 0xbe: return { LDX, ABY };
+	case 0xc0: return { CPY, IMM };	case 0xc1: return { CMP, IZX };	case 0xc4: return { CPY, ZP };	case 0xc5: return { CMP, ZP };
+	case 0xc6: return { DEC, ZP };	case 0xc8: return { INY, IMP };	case 0xc9: return { CMP, IMM };	case 0xca: return { DEX, IMP };
+	case 0xcc: return { CPY, ABS };	case 0xcd: return { CMP, ABS };	case 0xce: return { DEC, ABS };
+	case 0xd0: return { BNE, REL };	case 0xd1: return { CMP, IZY };	case 0xd5: return { CMP, ZPX };	case 0xd6: return { DEC, ZPX };
+	case 0xd8: return { CLD, IMP };	case 0xd9: return { CMP, ABY };	case 0xdd: return { CMP, ABX };	case 0xde: return { DEC, ABX };
+	case 0xe0: return { CPX, IMM };	case 0xe1: return { SBC, IZX };	case 0xe4: return { CPX, ZP };	case 0xe5: return { SBC, ZP };
+	case 0xe6: return { INC, ZP };	case 0xe8: return { INX, IMP };	case 0xe9: return { SBC, IMM };	case 0xea: return { NOP, IMP };
+	case 0xec: return { CPX, ABS };	case 0xed: return { SBC, ABS };	case 0xee: return { INC, ABS };
+	case 0xf0: return { BEQ, REL };	case 0xf1: return { SBC, IZY };	case 0xf5: return { SBC, ZPX };	case 0xf6: return { INC, ZPX };
+	case 0xf8: return { SED, IMP };	case 0xf9: return { SBC, ABY };	case 0xfd: return { SBC, ABX };	case 0xfe: return { INC, ABX };
+	default: return {};		// BRK, and everything undocumented
+	}
+}
+
+int EightBit::Translator::length(const addressing_t addressing) noexcept {
+	switch (addressing) {
+	case IMP: case ACC:
+		return 1;
+	case ABS: case ABX: case ABY: case IND:
+		return 3;
+	default:
+		return 2;
+	}
+}
+
+// Reads that take a cycle more when indexing crosses a page
+bool EightBit::Translator::penalised(const instruction_t instruction) noexcept {
+	switch (instruction.addressing) {
+	case ABX: case ABY: case IZY:
+		switch (instruction.operation) {
+		case STA: case ASL: case LSR: case ROL: case ROR: case INC: case DEC:
+			return false;
+		default:
+			return true;
+		}
+	default:
+		return false;
+	}
+}
+
+// False if the arena had to be flushed, taking "page" and "block" with it
+bool EightBit::Translator::translate(const register16_t pc, page_t& page, block_t& block) noexcept {
+
+	Emitter emitter(m_arena + m_used, ArenaSize - m_used);
+	m_emitter = &emitter;
+	m_sides.clear();
+	m_exits.clear();
+	m_cycles = 0;
+
+	prologue();
+
+	int maximum = 0;
+	size_t count = 0;
+	int offset = pc.low;
+	auto ended = false;
+	while (!ended) {
+
+		const auto* const bytes = page.storage + offset;
+		const auto instruction = decode(bytes[0]);
+		if (instruction.operation == XXX)
+			break;
+
+		const auto size = length(instruction.addressing);
+
+		// A branch crossing from the end of the page could touch the next
+		if (offset + size > 0xff + (instruction.addressing != REL))
+			break;
+
+		const auto address = static_cast<uint16_t>((pc.high << 8) + offset);
+		m_sides.push_back({ {}, address, m_cycles });
+		m_cycles += MOS6502::m_instructionCycles[bytes[0]];
+		maximum += MOS6502::m_instructionCycles[bytes[0]] + (penalised(instruction) ? 1 : 0) + (instruction.addressing == REL ? 2 : 0);
+		translate(instruction, address, bytes);
+
+		for (int i = 0; i < size; ++i)
+			page.covered[offset + i] = true;
+		offset += size;
+		const auto next = static_cast<uint16_t>((pc.high << 8) + offset);
+
+		switch (instruction.operation) {
+		case JMP: case JSR: case RTS: case RTI:
+			ended = true;
+			break;
+		case CLI: case PLP:
+			leave(next, m_cycles);
+			ended = true;
+			break;
+		default:
+			if ((++count == m_limit) || (offset > 0xff)) {
+				leave(next, m_cycles);
+				ended = true;
+			}
+			break;
+		}
+	}
+
+	if (!ended) {
+		if (count == 0) {
+			block.heat = Untranslatable;
+			m_emitter = nullptr;
+			return true;
+		}
+		leave(static_cast<uint16_t>((pc.high << 8) + offset), m_cycles);
+	}
+
+	sides();
+	epilogue();
+
+	m_emitter = nullptr;
+	if (emitter.overflowed()) {
+		flush();
+		return false;
+	}
+
+	block.entry = reinterpret_cast<entry_t>(m_arena + m_used);
+	block.maximum = maximum;
+	m_used += (emitter.position() + 0xf) & ~size_t(0xf);
+	return true;
+}
+
+// Only as many bytes as the instruction has are read
+void EightBit::Translator::translate(const instruction_t instruction, const uint16_t at, const uint8_t* const bytes) noexcept {
+
+	const auto next = static_cast<uint16_t>(at + length(instruction.addressing));
+
+	switch (instruction.operation) {
+
+	case LDA:
+		load(instruction, bytes);
+		emitter().mov8(A, Emitter::RAX);
+		adjustNZ(A);
+		break;
+	case LDX:
+		load(instruction, bytes);
+		emitter().mov8(X, Emitter::RAX);
+		adjustNZ(X);
+		break;
+	case LDY:
+		load(instruction, bytes);
+		emitter().mov8(Y, Emitter::RAX);
+		adjustNZ(Y);
+		break;
+
+	case STA:
+		write(address(instruction, bytes, false), A);
+		break;
+	case STX:
+		write(address(instruction, bytes, false), X);
+		break;
+	case STY:
+		write(address(instruction, bytes, false), Y);
+		break;
+
+	case ADC: case SBC:
+		emitter().test8(P, MOS6502::DF);
+		side(Emitter::NZ);
+		[[fallthrough]];
+	case AND: case ORA: case EOR: case BIT:
+		load(instruction, bytes);
+		arithmetic(instruction.operation);
+		break;
+
+	case CMP:
+		load(instruction, bytes);
+		compare(A);
+		break;
+	case CPX:
+		load(instruction, bytes);
+		compare(X);
+		break;
+	case CPY:
+		load(instruction, bytes);
+		compare(Y);
+		break;
+
+	case ASL: case LSR: case ROL: case ROR:
+		if (instruction.addressing == ACC)
+			shift(instruction.operation, A);
+		else
+			modify(instruction, address(instruction, bytes, false));
+		break;
+	case INC: case DEC:
+		modify(instruction, address(instruction, bytes, false));
+		break;
+
+	case INX:
+		emitter().inc8(X);
+		adjustNZ(X);
+		break;
+	case INY:
+		emitter().inc8(Y);
+		adjustNZ(Y);
+		break;
+	case DEX:
+		emitter().dec8(X);
+		adjustNZ(X);
+		break;
+	case DEY:
+		emitter().dec8(Y);
+		adjustNZ(Y);
+		break;
+
+	case TAX:
+		emitter().mov8(X, A);
+		adjustNZ(X);
+		break;
+	case TAY:
+		emitter().mov8(Y, A);
+		adjustNZ(Y);
+		break;
+	case TXA:
+		emitter().mov8(A, X);
+		adjustNZ(A);
+		break;
+	case TYA:
+		emitter().mov8(A, Y);
+		adjustNZ(A);
+		break;
+	case TSX:
+		emitter().mov8(X, S);
+		adjustNZ(X);
+		break;
+	case TXS:
+		emitter().mov8(S, X);
+		break;
+
+	case CLC: emitter().arithmetic8(Emitter::AND, P, uint8_t(~MOS6502::CF)); break;
+	case SEC: emitter().arithmetic8(Emitter::OR, P, uint8_t(MOS6502::CF)); break;
+	case CLI: emitter().arithmetic8(Emitter::AND, P, uint8_t(~MOS6502::IF)); break;
+	case SEI: emitter().arithmetic8(Emitter::OR, P, uint8_t(MOS6502::IF)); break;
+	case CLV: emitter().arithmetic8(Emitter::AND, P, uint8_t(~MOS6502::VF)); break;
+	case CLD: emitter().arithmetic8(Emitter::AND, P, uint8_t(~MOS6502::DF)); break;
+	case SED: emitter().arithmetic8(Emitter::OR, P, uint8_t(MOS6502::DF)); break;
+
+	case NOP:
+		break;
+
+	case PHA:
+		writable(1);
+		emitter().store8(Emitter::RAX, S, A);
+		emitter().dec8(S);
+		break;
+	case PHP:
+		writable(1);
+		emitter().mov8(Emitter::RCX, P);
+		emitter().arithmetic8(Emitter::OR, Emitter::RCX, uint8_t(MOS6502::BF));
+		emitter().store8(Emitter::RAX, S, Emitter::RCX);
+		emitter().dec8(S);
+		break;
+	case PLA:
+		readable(1);
+		emitter().inc8(S);
+		emitter().load8(A, Emitter::RAX, S);
+		adjustNZ(A);
+		break;
+	case PLP:
+		readable(1);
+		pull(P);
+		break;
+
+	case JSR: {
+			const auto pushed = static_cast<uint16_t>(at + 2);
+			readable(1);
+			writable(1);
+			emitter().store8(Emitter::RAX, S, uint8_t(pushed >> 8));
+			emitter().dec8(S);
+			emitter().store8(Emitter::RAX, S, uint8_t(pushed & 0xff));
+			emitter().dec8(S);
+			leave(register16_t(bytes[1], bytes[2]).joined, m_cycles);
+		}
+		break;
+
+	case RTS:
+		readable(1);
+		emitter().movzx8(Emitter::RCX, S);
+		emitter().inc8(Emitter::RCX);
+		emitter().movzx8(Emitter::RDX, Emitter::RAX, Emitter::RCX);
+		emitter().inc8(Emitter::RCX);
+		emitter().movzx8(Emitter::RCX, Emitter::RAX, Emitter::RCX);
+		readable(Emitter::RCX, Emitter::RAX);	// Where the return address is read again
+		emitter().shift32(Emitter::SHL, Emitter::RCX, 8);
+		emitter().arithmetic32(Emitter::OR, Emitter::RDX, Emitter::RCX);
+		emitter().arithmetic8(Emitter::ADD, S, uint8_t(2));
+		emitter().arithmetic32(Emitter::ADD, Emitter::RDX, 1);
+		emitter().movzx16(Emitter::RDX, Emitter::RDX);
+		leave(m_cycles);
+		break;
+
+	case RTI:
+		readable(1);
+		pull(P);
+		emitter().inc8(S);
+		emitter().movzx8(Emitter::RDX, Emitter::RAX, S);
+		emitter().inc8(S);
+		emitter().movzx8(Emitter::RCX, Emitter::RAX, S);
+		emitter().shift32(Emitter::SHL, Emitter::RCX, 8);
+		emitter().arithmetic32(Emitter::OR, Emitter::RDX, Emitter::RCX);
+		leave(m_cycles);
+		break;
+
+	case JMP:
+		if (instruction.addressing == ABS) {
+			leave(register16_t(bytes[1], bytes[2]).joined, m_cycles);
+		} else {
+			// The high byte is read without carrying into the pointer's page
+			const register16_t pointer(bytes[1], bytes[2]);
+			readable(pointer.high);
+			emitter().movzx8(Page, Emitter::RAX, pointer.low);
+			emitter().movzx8(Emitter::RDX, Emitter::RAX, uint8_t(pointer.low + 1));
+			emitter().shift32(Emitter::SHL, Emitter::RDX, 8);
+			emitter().arithmetic32(Emitter::OR, Emitter::RDX, Page);
+			leave(m_cycles);
+		}
+		break;
+
+	case BCC: case BCS: case BEQ: case BMI: case BNE: case BPL: case BVC: case BVS:
+		branch(instruction.operation, next, int8_t(bytes[1]));
+		break;
+
+	default:
+		assert(false && "Untranslatable instruction");
+		break;
+	}
+
+	if (penalised(instruction))
+		penalise();
+
+	// No need for an exit that's never taken
+	if (m_sides.back().from.empty())
+		m_sides.pop_back();
+}
+
+#pragma region Code generation
+
+void EightBit::Translator::prologue() noexcept {
+	for (const auto reg : { Emitter::RBX, Emitter::RBP, Emitter::RSI, Emitter::RDI, Emitter::R12, Emitter::R13, Emitter::R14, Emitter::R15 })
+		emitter().push(reg);
+#if defined(_WIN32)
+	emitter().mov64(Context, Emitter::RCX);
+#else
+	emitter().mov64(Context, Emitter::RDI);
+#endif
+	emitter().load64(Reads, Context, offsetof(context_t, reads));
+	emitter().load64(Writes, Context, offsetof(context_t, writes));
+	emitter().load64(NZ, Context, offsetof(context_t, nz));
+	emitter().movzx8(A, Context, offsetof(context_t, a));
+	emitter().movzx8(X, Context, offsetof(context_t, x));
+	emitter().movzx8(Y, Context, offsetof(context_t, y));
+	emitter().movzx8(S, Context, offsetof(context_t, s));
+	emitter().movzx8(P, Context, offsetof(context_t, p));
+	emitter().arithmetic32(Emitter::XOR, Cycles, Cycles);
+}
+
+void EightBit::Translator::epilogue() noexcept {
+	for (const auto exit : m_exits)
+		emitter().bind(exit);
+	emitter().store8(Context, offsetof(context_t, a), A);
+	emitter().store8(Context, offsetof(context_t, x), X);
+	emitter().store8(Context, offsetof(context_t, y), Y);
+	emitter().store8(Context, offsetof(context_t, s), S);
+	emitter().store8(Context, offsetof(context_t, p), P);
+	emitter().store32(Context, offsetof(context_t, cycles), Cycles);
+	for (const auto reg : { Emitter::R15, Emitter::R14, Emitter::R13, Emitter::R12, Emitter::RDI, Emitter::RSI, Emitter::RBP, Emitter::RBX })
+		emitter().pop(reg);
+	emitter().ret();
+}
+
+void EightBit::Translator::leave(const uint16_t address, const int cycles) noexcept {
+	if (cycles != 0)
+		emitter().arithmetic32(Emitter::ADD, Cycles, cycles);
+	emitter().store16(Context, offsetof(context_t, pc), address);
+	m_exits.push_back(emitter().jump());
+}
+
+void EightBit::Translator::leave(const int cycles) noexcept {
+	if (cycles != 0)
+		emitter().arithmetic32(Emitter::ADD, Cycles, cycles);
+	emitter().store16(Context, offsetof(context_t, pc), Emitter::RDX);
+	m_exits.push_back(emitter().jump());
+}
+
+void EightBit::Translator::side(const Emitter::condition_t condition) noexcept {
+	m_sides.back().from.push_back(emitter().jump(condition));
+}
+
+void EightBit::Translator::sides() noexcept {
+	for (const auto& side : m_sides) {
+		for (const auto from : side.from)
+			emitter().bind(from);
+		emitter().store8(Context, offsetof(context_t, exited), uint8_t(1));
+		leave(side.address, side.cycles);
+	}
+}
+
+void EightBit::Translator::adjustNZ(const Emitter::reg_t reg) noexcept {
+	emitter().arithmetic8(Emitter::AND, P, uint8_t(~(MOS6502::NF | MOS6502::ZF)));
+	emitter().movzx8(Emitter::RCX, reg);
+	emitter().arithmetic8(Emitter::OR, P, NZ, Emitter::RCX);
+}
+
+void EightBit::Translator::adjustCarry(const Emitter::condition_t condition, const Emitter::reg_t scratch) noexcept {
+	emitter().set(condition, scratch);
+	emitter().arithmetic8(Emitter::AND, P, uint8_t(~MOS6502::CF));
+	emitter().arithmetic8(Emitter::OR, P, scratch);
+}
+
+void EightBit::Translator::penalise() noexcept {
+	emitter().movzx8(Emitter::RAX, Penalty);
+	emitter().arithmetic32(Emitter::ADD, Cycles, Emitter::RAX);
+}
+
+void EightBit::Translator::readable(const uint8_t page, const Emitter::reg_t into) noexcept {
+	emitter().load64(into, Reads, page * 8);
+	emitter().test64(into, into);
+	side();
+}
+
+void EightBit::Translator::readable(const Emitter::reg_t page, const Emitter::reg_t into) noexcept {
+	emitter().load64(into, Reads, page);
+	emitter().test64(into, into);
+	side();
+}
+
+void EightBit::Translator::writable(const uint8_t page, const Emitter::reg_t into) noexcept {
+	emitter().load64(into, Writes, page * 8);
+	emitter().test64(into, into);
+	side();
+}
+
+void EightBit::Translator::writable(const Emitter::reg_t page, const Emitter::reg_t into) noexcept {
+	emitter().load64(into, Writes, page);
+	emitter().test64(into, into);
+	side();
+}
+
+// Indexed addressing also reads the page before any fixup, so that has to be plain memory too
+EightBit::Translator::operand_t EightBit::Translator::address(const instruction_t instruction, const uint8_t* const bytes, const bool reading) noexcept {
+
+	const auto penalty = reading && penalised(instruction);
+
+	switch (instruction.addressing) {
+	case ZP:
+		return { true, bytes[1] };
+	case ABS:
+		return { true, register16_t(bytes[1], bytes[2]).joined };
+	case ZPX: case ZPY:
+		emitter().mov32(Emitter::RDX, bytes[1]);
+		emitter().arithmetic8(Emitter::ADD, Emitter::RDX, instruction.addressing == ZPX ? X : Y);
+		return {};
+	case ABX: case ABY: {
+			const register16_t absolute(bytes[1], bytes[2]);
+			const auto index = instruction.addressing == ABX ? X : Y;
+			readable(absolute.high);
+			if (penalty) {
+				emitter().arithmetic8(Emitter::CMP, index, uint8_t(0xff - absolute.low));
+				emitter().set(Emitter::A, Penalty);
+			}
+			emitter().movzx8(Emitter::RDX, index);
+			emitter().arithmetic32(Emitter::ADD, Emitter::RDX, absolute.joined);
+			emitter().movzx16(Emitter::RDX, Emitter::RDX);
+		}
+		return {};
+	case IZX:
+		readable(0);
+		emitter().mov32(Emitter::RDX, bytes[1]);
+		emitter().arithmetic8(Emitter::ADD, Emitter::RDX, X);
+		emitter().movzx8(Page, Emitter::RAX, Emitter::RDX);
+		emitter().inc8(Emitter::RDX);
+		emitter().movzx8(Emitter::RDX, Emitter::RAX, Emitter::RDX);
+		emitter().shift32(Emitter::SHL, Emitter::RDX, 8);
+		emitter().arithmetic32(Emitter::OR, Emitter::RDX, Page);
+		return {};
+	case IZY:
+		readable(0);
+		emitter().movzx8(Page, Emitter::RAX, bytes[1]);
+		emitter().movzx8(Emitter::RDX, Emitter::RAX, uint8_t(bytes[1] + 1));
+		readable(Emitter::RDX);
+		if (penalty) {
+			emitter().mov8(Emitter::RAX, Page);
+			emitter().arithmetic8(Emitter::ADD, Emitter::RAX, Y);
+			emitter().set(Emitter::C, Penalty);
+		}
+		emitter().shift32(Emitter::SHL, Emitter::RDX, 8);
+		emitter().arithmetic32(Emitter::OR, Emitter::RDX, Page);
+		emitter().movzx8(Emitter::RAX, Y);
+		emitter().arithmetic32(Emitter::ADD, Emitter::RDX, Emitter::RAX);
+		emitter().movzx16(Emitter::RDX, Emitter::RDX);
+		return {};
+	default:
+		assert(false && "Unexpected addressing mode");
+		return {};
+	}
+}
+
+void EightBit::Translator::read(const operand_t operand) noexcept {
+	if (operand.known) {
+		const register16_t address = operand.address;
+		readable(address.high);
+		emitter().movzx8(Emitter::RAX, Emitter::RAX, address.low);
+	} else {
+		emitter().mov32(Emitter::RAX, Emitter::RDX);
+		emitter().shift32(Emitter::SHR, Emitter::RAX, 8);
+		readable(Emitter::RAX);
+		emitter().movzx8(Emitter::RCX, Emitter::RDX);
+		emitter().movzx8(Emitter::RAX, Emitter::RAX, Emitter::RCX);
+	}
+}
+
+void EightBit::Translator::load(const instruction_t instruction, const uint8_t* const bytes) noexcept {
+	if (instruction.addressing == IMM)
+		emitter().mov8(Emitter::RAX, bytes[1]);
+	else
+		read(address(instruction, bytes, true));
+}
+
+void EightBit::Translator::write(const operand_t operand, const Emitter::reg_t source) noexcept {
+	if (operand.known) {
+		const register16_t address = operand.address;
+		writable(address.high);
+		emitter().store8(Emitter::RAX, address.low, source);
+	} else {
+		emitter().mov32(Emitter::RAX, Emitter::RDX);
+		emitter().shift32(Emitter::SHR, Emitter::RAX, 8);
+		writable(Emitter::RAX);
+		emitter().movzx8(Emitter::RCX, Emitter::RDX);
+		emitter().store8(Emitter::RAX, Emitter::RCX, source);
+	}
+}
+
+// Both pages are checked before anything changes
+void EightBit::Translator::modify(const instruction_t instruction, const operand_t operand) noexcept {
+
+	if (operand.known) {
+		writable(register16_t(operand.address).high, Page);
+	} else {
+		emitter().mov32(Emitter::RAX, Emitter::RDX);
+		emitter().shift32(Emitter::SHR, Emitter::RAX, 8);
+		writable(Emitter::RAX, Page);
+	}
+
+	read(operand);
+
+	switch (instruction.operation) {
+	case INC:
+		emitter().inc8(Emitter::RAX);
+		adjustNZ(Emitter::RAX);
+		break;
+	case DEC:
+		emitter().dec8(Emitter::RAX);
+		adjustNZ(Emitter::RAX);
+		break;
+	default:
+		shift(instruction.operation, Emitter::RAX);
+		break;
+	}
+
+	if (operand.known) {
+		emitter().store8(Page, register16_t(operand.address).low, Emitter::RAX);
+	} else {
+		emitter().movzx8(Emitter::RDX, Emitter::RDX);
+		emitter().store8(Page, Emitter::RDX, Emitter::RAX);
+	}
+}
+
+void EightBit::Translator::arithmetic(const operation_t operation) noexcept {
+	switch (operation) {
+	case AND:
+		emitter().arithmetic8(Emitter::AND, A, Emitter::RAX);
+		adjustNZ(A);
+		break;
+	case ORA:
+		emitter().arithmetic8(Emitter::OR, A, Emitter::RAX);
+		adjustNZ(A);
+		break;
+	case EOR:
+		emitter().arithmetic8(Emitter::XOR, A, Emitter::RAX);
+		adjustNZ(A);
+		break;
+	case BIT:
+		emitter().arithmetic8(Emitter::AND, P, uint8_t(~(MOS6502::NF | MOS6502::VF | MOS6502::ZF)));
+		emitter().mov8(Emitter::RCX, Emitter::RAX);
+		emitter().arithmetic8(Emitter::AND, Emitter::RCX, uint8_t(MOS6502::NF | MOS6502::VF));
+		emitter().arithmetic8(Emitter::OR, P, Emitter::RCX);
+		emitter().test8(A, Emitter::RAX);
+		emitter().set(Emitter::Z, Emitter::RCX);
+		emitter().shift8(Emitter::SHL, Emitter::RCX);
+		emitter().arithmetic8(Emitter::OR, P, Emitter::RCX);
+		break;
+	case ADC: case SBC:
+		// x86 borrows where the 6502 carries
+		emitter().bt32(P, 0);
+		if (operation == SBC)
+			emitter().cmc();
+		emitter().arithmetic8(operation == ADC ? Emitter::ADC : Emitter::SBB, A, Emitter::RAX);
+		emitter().set(operation == ADC ? Emitter::C : Emitter::NC, Emitter::RAX);
+		emitter().set(Emitter::O, Emitter::RCX);
+		emitter().arithmetic8(Emitter::AND, P, uint8_t(~(MOS6502::VF | MOS6502::CF)));
+		emitter().arithmetic8(Emitter::OR, P, Emitter::RAX);
+		emitter().shift8(Emitter::SHL, Emitter::RCX, 6);
+		emitter().arithmetic8(Emitter::OR, P, Emitter::RCX);
+		adjustNZ(A);
+		break;
+	default:
+		assert(false && "Unexpected arithmetic operation");
+		break;
+	}
+}
+
+void EightBit::Translator::compare(const Emitter::reg_t reg) noexcept {
+	emitter().mov8(Emitter::RCX, reg);
+	emitter().arithmetic8(Emitter::SUB, Emitter::RCX, Emitter::RAX);
+	adjustCarry(Emitter::NC, Emitter::RAX);
+	adjustNZ(Emitter::RCX);
+}
+
+void EightBit::Translator::shift(const operation_t operation, const Emitter::reg_t reg) noexcept {
+	if (operation == ROL || operation == ROR)
+		emitter().bt32(P, 0);
+	switch (operation) {
+	case ASL: emitter().shift8(Emitter::SHL, reg); break;
+	case LSR: emitter().shift8(Emitter::SHR, reg); break;
+	case ROL: emitter().shift8(Emitter::RCL, reg); break;
+	case ROR: emitter().shift8(Emitter::RCR, reg); break;
+	default:
+		assert(false && "Unexpected shift operation");
+		break;
+	}
+	adjustCarry(Emitter::C);
+	adjustNZ(reg);
+}
+
+// Taken, it's a cycle more, and another if the target is on a different page.
+// Otherwise, the block carries on.
+void EightBit::Translator::branch(const operation_t operation, const uint16_t next, const int8_t displacement) noexcept {
+
+	uint8_t flag = 0;
+	auto set = false;
+	switch (operation) {
+	case BPL: flag = MOS6502::NF; break;
+	case BMI: flag = MOS6502::NF; set = true; break;
+	case BVC: flag = MOS6502::VF; break;
+	case BVS: flag = MOS6502::VF; set = true; break;
+	case BCC: flag = MOS6502::CF; break;
+	case BCS: flag = MOS6502::CF; set = true; break;
+	case BNE: flag = MOS6502::ZF; break;
+	case BEQ: flag = MOS6502::ZF; set = true; break;
+	default:
+		assert(false && "Unexpected branch");
+		break;
+	}
+
+	emitter().test8(P, flag);
+	const auto untaken = emitter().jump(set ? Emitter::Z : Emitter::NZ);
+
+	const auto target = register16_t(next + displacement);
+	const auto crossed = target.high != register16_t(next).high;
+	leave(target.joined, m_cycles + 1 + (crossed ? 1 : 0));
+
+	emitter().bind(untaken);
+}
+
+// With RF set and BF clear, as PLP leaves them
+void EightBit::Translator::pull(const Emitter::reg_t into) noexcept {
+	emitter().inc8(S);
+	emitter().movzx8(Emitter::RCX, Emitter::RAX, S);
+	emitter().arithmetic8(Emitter::OR, Emitter::RCX, uint8_t(MOS6502::RF));
+	emitter().arithmetic8(Emitter::AND, Emitter::RCX, uint8_t(~MOS6502::BF));
+	emitter().mov8(into, Emitter::RCX);
+}
+
+#pragma endregion
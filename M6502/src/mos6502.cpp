@@ -1,8 +1,58 @@
 ﻿#include "stdafx.h"
 #include "../inc/mos6502.h"
 
-EightBit::MOS6502::MOS6502(Bus& bus) noexcept
-: base(bus) {
+// JAM is as this implementation times it, reading the vector until RESET
+const std::array<uint8_t, 0x100> EightBit::MOS6502::m_instructionCycles = {
+//	0	1	2	3	4	5	6	7	8	9	a	b	c	d	e	f
+	7,	6,	11,	8,	3,	3,	5,	5,	3,	2,	2,	2,	4,	4,	6,	6,	// 0
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// 1
+	6,	6,	11,	8,	3,	3,	5,	5,	4,	2,	2,	2,	4,	4,	6,	6,	// 2
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// 3
+	6,	6,	11,	8,	3,	3,	5,	5,	3,	2,	2,	2,	3,	4,	6,	6,	// 4
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// 5
+	6,	6,	11,	8,	3,	3,	5,	5,	4,	2,	2,	2,	5,	4,	6,	6,	// 6
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// 7
+	2,	6,	2,	6,	3,	3,	3,	3,	2,	2,	2,	2,	4,	4,	4,	4,	// 8
+	2,	6,	11,	6,	4,	4,	4,	4,	2,	5,	2,	5,	5,	5,	5,	5,	// 9
+	2,	6,	2,	6,	3,	3,	3,	3,	2,	2,	2,	2,	4,	4,	4,	4,	// a
+	2,	5,	11,	5,	4,	4,	4,	4,	2,	4,	2,	4,	4,	4,	4,	4,	// b
+	2,	6,	2,	8,	3,	3,	5,	5,	2,	2,	2,	2,	4,	4,	6,	6,	// c
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// d
+	2,	6,	2,	8,	3,	3,	5,	5,	2,	2,	2,	2,	4,	4,	6,	6,	// e
+	2,	5,	11,	8,	4,	4,	6,	6,	2,	4,	2,	7,	4,	4,	7,	7,	// f
+};
+
+constexpr uint8_t EightBit::MOS6502::decimalAdd(const int first, const int second, const int carry) noexcept {
+	const auto sum = first + second + carry;
+	const auto carrying = sum > 9;
+	const auto digit = lowNibble(carrying ? sum + 6 : sum);
+	return digit | (carrying ? Bit4 : 0) | ((sum & Bit3) << 4);
+}
+
+constexpr uint8_t EightBit::MOS6502::decimalSubtract(const int first, const int second, const int borrow) noexcept {
+	const auto difference = first - second - borrow;
+	const auto borrowing = difference < 0;
+	const auto digit = lowNibble(borrowing ? difference - 6 : difference);
+	return digit | (borrowing ? Bit4 : 0);
+}
+
+constexpr std::array<uint8_t, 0x200> EightBit::MOS6502::m_decimalAddition = [] {
+	std::array<uint8_t, 0x200> digits;
+	for (int index = 0; index < 0x200; ++index)
+		digits[index] = decimalAdd((index >> 4) & Mask4, index & Mask4, index >> 8);
+	return digits;
+}();
+
+constexpr std::array<uint8_t, 0x200> EightBit::MOS6502::m_decimalSubtraction = [] {
+	std::array<uint8_t, 0x200> digits;
+	for (int index = 0; index < 0x200; ++index)
+		digits[index] = decimalSubtract((index >> 4) & Mask4, index & Mask4, index >> 8);
+	return digits;
+}();
+
+EightBit::MOS6502::MOS6502(Bus& bus, const mode_t mode) noexcept
+: base(bus),
+  m_mode(mode) {
 	RaisedPOWER.connect([this](EventArgs) {
 		X() = Bit7;
 		Y() = 0;
@@ -14,6 +64,21 @@ EightBit::MOS6502::MOS6502(Bus& bus) noexcept
 	});
 }
 
+void EightBit::MOS6502::translate(const bool enabled, const size_t limit, const uint16_t threshold) {
+	m_translator.reset();
+	if (enabled && Translator::Supported)
+		m_translator = std::make_unique<Translator>(*this, BUS(), limit, threshold);
+}
+
+void EightBit::MOS6502::flush() noexcept {
+	if (translating())
+		m_translator->flush();
+}
+
+size_t EightBit::MOS6502::footprint() const noexcept {
+	return translating() ? m_translator->footprint() : 0;
+}
+
 DEFINE_PIN_LEVEL_CHANGERS(NMI, MOS6502)
 DEFINE_PIN_LEVEL_CHANGERS(SO, MOS6502)
 DEFINE_PIN_LEVEL_CHANGERS(SYNC, MOS6502)
@@ -31,6 +96,15 @@ void EightBit::MOS6502::poweredStep() noexcept {
 	if (raised(RDY())) {
 
 		m_immediateInstruction = false;
+		m_quiet = (mode() == mode_t::Fast) && !interrupting() && !observed();
+
+		m_translated = m_quiet && translating() && !trapping() && !ExecutingInstruction.attached() && !ExecutedInstruction.attached() && m_translator->run();
+		if (m_translated)
+			return;
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+		m_threaded = false;
+#endif
 		opcode() = fetchInstruction();
 
 		// Priority: RESET > NMI > INT
@@ -40,13 +114,97 @@ void EightBit::MOS6502::poweredStep() noexcept {
 			handleNMI();
 		else if (lowered(INT()) && !interruptMasked())
 			handleINT();
-		else
-			execute();
+		else {
+#ifdef EIGHTBIT_THREADED_DISPATCH
+			m_threading = m_quiet && !ExecutingInstruction.attached() && !ExecutedInstruction.attached();
+			dispatchVariant();
+			m_threading = false;
+#else
+			dispatchVariant();
+#endif
+		}
+
+		// Page crossings and taken branches have already been counted
+		if (m_quiet)
+			tick(m_instructionCycles[opcode()] - 1);
+	}
+}
+
+bool EightBit::MOS6502::interrupting() noexcept {
+	return lowered(RESET()) || lowered(NMI()) || (lowered(INT()) && !interruptMasked());
+}
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+
+// Straight on into the next instruction, if nothing could tell that the step hasn't ended
+bool EightBit::MOS6502::proceed() noexcept {
+
+	if (ends(opcode()))
+		return false;
+
+	if (!powered() || lowered(SO()) || lowered(RDY()) || interrupting() || trapped(PC()))
+		return false;
+
+	const auto remaining = m_instructionCycles[opcode()] - 1;
+	const auto& scheduler = BUS().scheduler();
+	if (scheduler.now() + cycles() + remaining + 1 >= scheduler.next())
+		return false;
+
+	tick(remaining + 1);
+	m_immediateInstruction = false;
+	startInstruction();
+	opcode() = fetchInstruction();
+	m_threaded = true;
+	return true;
+}
+
+#endif
+
+bool EightBit::MOS6502::observed() noexcept {
+	return Ticked.attached()
+		|| PIN_ATTACHED(SYNC) || PIN_ATTACHED(RW)
+		|| ReadingMemory.attached() || ReadMemory.attached()
+		|| WritingMemory.attached() || WrittenMemory.attached();
+}
+
+// Held by RDY, or a JMP/branch to itself
+bool EightBit::MOS6502::spinning() noexcept {
+
+	if (lowered(SO()))
+		return false;
+
+	if (lowered(RDY()))
+		return true;
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+	if (m_threaded)
+		return false;
+#endif
+
+	if (m_translated || interrupting())
+		return false;
+
+	if (PIN_OBSERVED(SYNC) || PIN_OBSERVED(RW))
+		return false;
+
+	switch (opcode()) {
+	case 0x4c:											// JMP (absolute)
+	case 0x10: case 0x30: case 0x50: case 0x70:			// Bxx (relative)
+	case 0x90: case 0xb0: case 0xd0: case 0xf0:
+		return true;
+	default:
+		return false;
 	}
 }
 
 uint8_t EightBit::MOS6502::fetchInstruction() noexcept {
 
+	if (m_quiet) {
+		immediateAddress();
+		base::memoryRead();
+		return BUS().DATA();
+	}
+
 	// Instruction fetch beginning
 	lowerSYNC();
 
@@ -123,18 +281,37 @@ void EightBit::MOS6502::BRK() noexcept {
 }
 
 void EightBit::MOS6502::swallowRead() noexcept {
-	base::memoryRead(PC());
+	BUS().ADDRESS() = PC();
+	dummyRead();
 }
 
 void EightBit::MOS6502::swallowPop() noexcept {
-	base::memoryRead({ S(), 1 });
+	BUS().ADDRESS() = { S(), 1 };
+	dummyRead();
 }
 
 void EightBit::MOS6502::swallowFetch() noexcept {
-	fetchByte();
+	immediateAddress();
+	dummyRead();
+}
+
+void EightBit::MOS6502::dummyRead() noexcept {
+	if (!m_quiet || BUS().readable(BUS().ADDRESS().high) == nullptr)
+		memoryRead();
 }
 
+void EightBit::MOS6502::dummyWrite() noexcept {
+	if (!m_quiet || BUS().writable(BUS().ADDRESS().high) == nullptr)
+		memoryWrite();
+}
+
+// Quietly, the clock is left to "poweredStep"
+
 void EightBit::MOS6502::memoryWrite() noexcept {
+	if (m_quiet) {
+		base::memoryWrite();
+		return;
+	}
 	WritingMemory.fire();
 		tick();
 		writeToMemory();
@@ -142,6 +319,10 @@ void EightBit::MOS6502::memoryWrite() noexcept {
 }
 
 void EightBit::MOS6502::memoryRead() noexcept {
+	if (m_quiet) {
+		base::memoryRead();
+		return;
+	}
 	ReadingMemory.fire();
 		tick();
 		readFromMemory();
@@ -160,7 +341,7 @@ void EightBit::MOS6502::writeToMemory() noexcept {
 
 void EightBit::MOS6502::modifyWrite(uint8_t data) noexcept {
 	// The read will have already taken place...
-	memoryWrite();					// Modify cycle
+	dummyWrite();					// Modify cycle
 	Processor::memoryWrite(data);	// Write cycle
 }
 
@@ -169,12 +350,15 @@ void EightBit::MOS6502::modifyWrite(uint8_t data) noexcept {
 #pragma region Address page fixup
 
 void EightBit::MOS6502::maybeFixup() noexcept {
-	if (BUS().ADDRESS().high != fixedPage())
+	if (BUS().ADDRESS().high != fixedPage()) {
+		if (m_quiet)
+			tick();		// Page crossing
 		fixup();
+	}
 }
 
 void EightBit::MOS6502::fixup() noexcept {
-	memoryRead();
+	dummyRead();
 	BUS().ADDRESS().high = fixedPage();
 }
 
@@ -305,284 +489,343 @@ void EightBit::MOS6502::indirectIndexedY() noexcept {
 
 //
 
+// Each step starts with a switch.  Threaded, each handler then runs straight on
+// into the next instruction, through an indirect branch of its own.
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+#	define OPCODE(value)	case value: opcode_ ## value: __attribute__((unused));
+#	define NEXT				do { if constexpr (Threaded) { if (proceed()) goto *handlers[opcode()]; } return; } while (false)
+#	define HANDLER(high, low)	&&opcode_0x ## high ## low
+#	define HANDLERS(high) \
+		HANDLER(high, 0), HANDLER(high, 1), HANDLER(high, 2), HANDLER(high, 3), \
+		HANDLER(high, 4), HANDLER(high, 5), HANDLER(high, 6), HANDLER(high, 7), \
+		HANDLER(high, 8), HANDLER(high, 9), HANDLER(high, a), HANDLER(high, b), \
+		HANDLER(high, c), HANDLER(high, d), HANDLER(high, e), HANDLER(high, f)
+#else
+#	define OPCODE(value)	case value:
+#	define NEXT				break
+#endif
+
 void EightBit::MOS6502::execute() noexcept {
+	dispatchVariant();
+}
+
+void EightBit::MOS6502::dispatchVariant() noexcept {
+	dispatch<NMOS>();
+}
+
+// The threaded form is only worth its larger code while it is threading
+template<class Variant>
+void EightBit::MOS6502::dispatch() noexcept {
+#ifdef EIGHTBIT_THREADED_DISPATCH
+	if (m_threading) {
+		interpret<Variant, true>();
+		return;
+	}
+#endif
+	interpret<Variant, false>();
+}
+
+template<class Variant, bool Threaded>
+void EightBit::MOS6502::interpret() noexcept {
+
+#ifdef EIGHTBIT_THREADED_DISPATCH
+	// Only taking the labels' addresses where they are used leaves the switch alone
+	const void* const* handlers = nullptr;
+	if constexpr (Threaded) {
+		static const void* const threaded[0x100] = {
+			HANDLERS(0), HANDLERS(1), HANDLERS(2), HANDLERS(3),
+			HANDLERS(4), HANDLERS(5), HANDLERS(6), HANDLERS(7),
+			HANDLERS(8), HANDLERS(9), HANDLERS(a), HANDLERS(b),
+			HANDLERS(c), HANDLERS(d), HANDLERS(e), HANDLERS(f),
+		};
+		handlers = threaded;
+	}
+#endif
 
 	switch (opcode()) {
 
-	case 0x00:	swallowFetch(); BRK();							break;	// BRK (implied)
-	case 0x01:	indexedIndirectX(); ORA();						break;	// ORA (indexed indirect X)
-	case 0x02:	swallowRead(); JAM();							break;	// *JAM
-	case 0x03:	indexedIndirectX(); SLO();						break;	// *SLO (indexed indirect X)
-	case 0x04:	zeroPage();	NOP();								break;	// *NOP (zero page)
-	case 0x05:	zeroPage(); ORA();								break;	// ORA (zero page)
-	case 0x06:	zeroPage(); ASL();								break;	// ASL (zero page)
-	case 0x07:	zeroPage(); SLO();								break;	// *SLO (zero page)
-	case 0x08:	swallowRead(); PHP();							break;	// PHP (implied)
-	case 0x09:	immediate(); ORA();								break;	// ORA (immediate)
-	case 0x0a:	swallowRead(); ASLA();							break;	// ASL A (implied)
-	case 0x0b:	immediate(); ANC();								break;	// *ANC (immediate)
-	case 0x0c:	absolute(); NOP(); 								break;	// *NOP (absolute)
-	case 0x0d:	absolute(); ORA();								break;	// ORA (absolute)
-	case 0x0e:	absolute(); ASL();								break;	// ASL (absolute)
-	case 0x0f:	absolute(); SLO();								break;	// *SLO (absolute)
-
-	case 0x10:	immediate(); BPL();								break;	// BPL (relative)
-	case 0x11:	indirectIndexedY(); ORA();						break;	// ORA (indirect indexed Y)
-	case 0x12:	swallowRead(); JAM();							break;	// *JAM
-	case 0x13:	indirectIndexedYAddress(); fixupRead(); SLO();	break;	// *SLO (indirect indexed Y)
-	case 0x14:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0x15:	zeroPageX(); ORA();								break;	// ORA (zero page, X)
-	case 0x16:	zeroPageX(); ASL();								break;	// ASL (zero page, X)
-	case 0x17:	zeroPageX(); SLO();								break;	// *SLO (zero page, X)
-	case 0x18:	swallowRead(); resetFlag(CF);					break;	// CLC (implied)
-	case 0x19:	absoluteY(); ORA();								break;	// ORA (absolute, Y)
-	case 0x1a:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0x1b:	absoluteYAddress(); fixupRead(); SLO();			break;	// *SLO (absolute, Y)
-	case 0x1c:	absoluteXAddress(); maybeFixupRead();			break;	// *NOP (absolute, X)
-	case 0x1d:	absoluteX(); ORA();								break;	// ORA (absolute, X)
-	case 0x1e:	absoluteXAddress(); fixupRead(); ASL();			break;	// ASL (absolute, X)
-	case 0x1f:	absoluteXAddress(); fixupRead(); SLO();			break;	// *SLO (absolute, X)
-
-	case 0x20:	JSR();											break;	// JSR (absolute)
-	case 0x21:	indexedIndirectX(); AND();						break;	// AND (indexed indirect X)
-	case 0x22:	swallowRead(); JAM();							break;	// *JAM
-	case 0x23:	indexedIndirectX(); RLA();;						break;	// *RLA (indexed indirect X)
-	case 0x24:	zeroPage(); BIT();								break;	// BIT (zero page)
-	case 0x25:	zeroPage(); AND();								break;	// AND (zero page)
-	case 0x26:	zeroPage(); ROL();								break;	// ROL (zero page)
-	case 0x27:	zeroPage(); RLA();;								break;	// *RLA (zero page)
-	case 0x28:	swallowRead(); PLP();							break;	// PLP (implied)
-	case 0x29:	immediate(); AND();								break;	// AND (immediate)
-	case 0x2a:	swallowRead(); ROLA();							break;	// ROL A (implied)
-	case 0x2b:	immediate(); ANC();								break;	// *ANC (immediate)
-	case 0x2c:	absolute(); BIT();								break;	// BIT (absolute)
-	case 0x2d:	absolute(); AND();								break;	// AND (absolute)
-	case 0x2e:	absolute(); ROL();								break;	// ROL (absolute)
-	case 0x2f:	absolute(); RLA();;								break;	// *RLA (absolute)
-
-	case 0x30:	immediate(); BMI();								break;	// BMI (relative)
-	case 0x31:	indirectIndexedY(); AND();						break;	// AND (indirect indexed Y)
-	case 0x32:	swallowRead(); JAM();							break;	// *JAM
-	case 0x33:	indirectIndexedYAddress(); fixupRead(); RLA();	break;	// *RLA (indirect indexed Y)
-	case 0x34:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0x35:	zeroPageX(); AND();								break;	// AND (zero page, X)
-	case 0x36:	zeroPageX(); ROL();								break;	// ROL (zero page, X)
-	case 0x37:	zeroPageX(); RLA();;							break;	// *RLA (zero page, X)
-	case 0x38:	swallowRead(); SEC();							break;	// SEC (implied)
-	case 0x39:	absoluteY(); AND();								break;	// AND (absolute, Y)
-	case 0x3a:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0x3b:	absoluteYAddress(); fixupRead(); RLA();			break;	// *RLA (absolute, Y)
-	case 0x3c:	absoluteXAddress(); maybeFixupRead(); NOP();	break;	// *NOP (absolute, X)
-	case 0x3d:	absoluteX(); AND();								break;	// AND (absolute, X)
-	case 0x3e:	absoluteXAddress(); fixupRead(); ROL();			break;	// ROL (absolute, X)
-	case 0x3f:	absoluteXAddress(); fixupRead(); RLA();         break;	// *RLA (absolute, X)
-
-	case 0x40:	swallowRead(); RTI();							break;	// RTI (implied)
-	case 0x41:	indexedIndirectX(); EOR();						break;	// EOR (indexed indirect X)
-	case 0x42:	swallowRead(); JAM();							break;	// *JAM
-	case 0x43:	indexedIndirectX(); SRE();						break;	// *SRE (indexed indirect X)
-	case 0x44:	zeroPage();	NOP();								break;	// *NOP (zero page)
-	case 0x45:	zeroPage(); EOR();								break;	// EOR (zero page)
-	case 0x46:	zeroPage(); LSR();								break;	// LSR (zero page)
-	case 0x47:	zeroPage(); SRE();								break;	// *SRE (zero page)
-	case 0x48:	swallowRead(); PHA();							break;	// PHA (implied)
-	case 0x49:	immediate(); EOR();								break;	// EOR (immediate)
-	case 0x4a:	swallowRead(); LSRA();							break;	// LSR A (implied)
-	case 0x4b:	immediate(); ASR();								break;	// *ASR (immediate)
-	case 0x4c:	absoluteAddress(); JMP();						break;	// JMP (absolute)
-	case 0x4d:	absolute(); EOR();								break;	// EOR (absolute)
-	case 0x4e:	absolute(); LSR(); 								break;	// LSR (absolute)
-	case 0x4f:	absolute(); SRE();								break;	// *SRE (absolute)
-
-	case 0x50:	immediate(); BVC();								break;	// BVC (relative)
-	case 0x51:	indirectIndexedY(); EOR();						break;	// EOR (indirect indexed Y)
-	case 0x52:	swallowRead(); JAM();							break;	// *JAM
-	case 0x53:	indirectIndexedYAddress(); fixupRead(); SRE();	break;	// *SRE (indirect indexed Y)
-	case 0x54:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0x55:	zeroPageX(); EOR();								break;	// EOR (zero page, X)
-	case 0x56:	zeroPageX(); LSR(); 							break;	// LSR (zero page, X)
-	case 0x57:	zeroPageX(); SRE();								break;	// *SRE (zero page, X)
-	case 0x58:	swallowRead(); CLI();							break;	// CLI (implied)
-	case 0x59:	absoluteY(); EOR();								break;	// EOR (absolute, Y)
-	case 0x5a:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0x5b:	absoluteYAddress(); fixupRead(); SRE();			break;	// *SRE (absolute, Y)
-	case 0x5c:	absoluteXAddress(); maybeFixupRead(); NOP();	break;	// *NOP (absolute, X)
-	case 0x5d:	absoluteX(); EOR();								break;	// EOR (absolute, X)
-	case 0x5e:	absoluteXAddress(); fixupRead(); LSR();			break;	// LSR (absolute, X)
-	case 0x5f:	absoluteXAddress(); fixupRead(); SRE();			break;	// *SRE (absolute, X)
-
-	case 0x60:	swallowRead(); RTS();							break;	// RTS (implied)
-	case 0x61:	indexedIndirectX(); ADC();						break;	// ADC (indexed indirect X)
-	case 0x62:	swallowRead(); JAM();							break;	// *JAM
-	case 0x63:	indexedIndirectX(); RRA();						break;	// *RRA (indexed indirect X)
-	case 0x64:	zeroPage();	NOP();								break;	// *NOP (zero page)
-	case 0x65:	zeroPage(); ADC();								break;	// ADC (zero page)
-	case 0x66:	zeroPage(); ROR();								break;	// ROR (zero page)
-	case 0x67:	zeroPage(); RRA();								break;	// *RRA (zero page)
-	case 0x68:	swallowRead(); PLA();							break;	// PLA (implied)
-	case 0x69:	immediate(); ADC();								break;	// ADC (immediate)
-	case 0x6a:	swallowRead(); RORA();							break;	// ROR A (implied)
-	case 0x6b:	immediate(); ARR();								break;	// *ARR (immediate)
-	case 0x6c:	indirectAddress(); JMP();						break;	// JMP (indirect)
-	case 0x6d:	absolute(); ADC();								break;	// ADC (absolute)
-	case 0x6e:	absolute(); ROR(); 								break;	// ROR (absolute)
-	case 0x6f:	absolute(); RRA();								break;	// *RRA (absolute)
-
-	case 0x70:	immediate(); BVS();								break;	// BVS (relative)
-	case 0x71:	indirectIndexedY(); ADC();						break;	// ADC (indirect indexed Y)
-	case 0x72:	swallowRead(); JAM();							break;	// *JAM
-	case 0x73:	indirectIndexedYAddress(); fixupRead(); RRA();	break;	// *RRA (indirect indexed Y)
-	case 0x74:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0x75:	zeroPageX(); ADC();								break;	// ADC (zero page, X)
-	case 0x76:	zeroPageX(); ROR(); 							break;	// ROR (zero page, X)
-	case 0x77:	zeroPageX(); RRA();								break;	// *RRA (zero page, X)
-	case 0x78:	swallowRead(); SEI();							break;	// SEI (implied)
-	case 0x79:	absoluteY(); ADC();								break;	// ADC (absolute, Y)
-	case 0x7a:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0x7b:	absoluteYAddress(); fixupRead(); RRA();			break;	// *RRA (absolute, Y)
-	case 0x7c:	absoluteXAddress(); maybeFixupRead(); NOP();	break;	// *NOP (absolute, X)
-	case 0x7d:	absoluteX(); ADC();								break;	// ADC (absolute, X)
-	case 0x7e:	absoluteXAddress(); fixupRead(); ROR();			break;	// ROR (absolute, X)
-	case 0x7f:	absoluteXAddress(); fixupRead(); RRA();			break;	// *RRA (absolute, X)
-
-	case 0x80:	immediate(); NOP();								break;	// *NOP (immediate)
-	case 0x81:	indexedIndirectXAddress(); STA();				break;	// STA (indexed indirect X)
-	case 0x82:	immediate(); NOP();								break;	// *NOP (immediate)
-	case 0x83:	indexedIndirectXAddress(); SAX();				break;	// *SAX (indexed indirect X)
-	case 0x84:	zeroPageAddress(); STY();						break;	// STY (zero page)
-	case 0x85:	zeroPageAddress(); STA();						break;	// STA (zero page)
-	case 0x86:	zeroPageAddress(); STX();						break;	// STX (zero page)
-	case 0x87:	zeroPageAddress(); SAX();						break;	// *SAX (zero page)
-	case 0x88:	swallowRead(); DEY();							break;	// DEY (implied)
-	case 0x89:	immediate(); NOP();								break;	// *NOP (immediate)
-	case 0x8a:	swallowRead(); TXA();							break;	// TXA (implied)
-	case 0x8b:	immediate(); ANE();								break;	// *ANE (immediate)
-	case 0x8c:	absoluteAddress(); STY();						break;	// STY (absolute)
-	case 0x8d:	absoluteAddress(); STA();						break;	// STA (absolute)
-	case 0x8e:	absoluteAddress(); STX();						break;	// STX (absolute)
-	case 0x8f:	absoluteAddress(); SAX();						break;	// *SAX (absolute)
-
-	case 0x90:	immediate(); BCC();								break;	// BCC (relative)
-	case 0x91:	indirectIndexedYAddress(); fixup(); STA();		break;	// STA (indirect indexed Y)
-	case 0x92:	swallowRead(); JAM();							break;	// *JAM
-	case 0x93:	indirectIndexedYAddress(); fixup(); SHA();		break;	// *SHA (indirect indexed, Y)
-	case 0x94:	zeroPageXAddress(); STY();						break;	// STY (zero page, X)
-	case 0x95:	zeroPageXAddress(); STA();						break;	// STA (zero page, X)
-	case 0x96:	zeroPageYAddress(); STX();						break;	// STX (zero page, Y)
-	case 0x97:	zeroPageYAddress(); SAX();						break;	// *SAX (zero page, Y)
-	case 0x98:	swallowRead(); TYA();							break;	// TYA (implied)
-	case 0x99:	absoluteYAddress(); fixup(); STA();				break;	// STA (absolute, Y)
-	case 0x9a:	swallowRead(); TXS();							break;	// TXS (implied)
-	case 0x9b:	absoluteYAddress(); fixup(); TAS();				break;	// *TAS (absolute, Y)
-	case 0x9c:	absoluteXAddress(); fixup(); SYA();				break;	// *SYA (absolute, X)
-	case 0x9d:	absoluteXAddress(); fixup(); STA();				break;	// STA (absolute, X)
-	case 0x9e:	absoluteYAddress(); fixup(); SXA();				break;	// *SXA (absolute, Y)
-	case 0x9f:	absoluteYAddress(); fixup(); SHA();				break;	// *SHA (absolute, Y)
-
-	case 0xa0:	immediate(); LDY();								break;	// LDY (immediate)
-	case 0xa1:	indexedIndirectX(); LDA();						break;	// LDA (indexed indirect X)
-	case 0xa2:	immediate(); LDX();								break;	// LDX (immediate)
-	case 0xa3:	indexedIndirectX(); LAX();						break;	// *LAX (indexed indirect X)
-	case 0xa4:	zeroPage(); LDY();								break;	// LDY (zero page)
-	case 0xa5:	zeroPage(); LDA();								break;	// LDA (zero page)
-	case 0xa6:	zeroPage(); LDX();								break;	// LDX (zero page)
-	case 0xa7:	zeroPage(); LAX();								break;	// *LAX (zero page)
-	case 0xa8:	swallowRead(); TAY();							break;	// TAY (implied)
-	case 0xa9:	immediate(); LDA();								break;	// LDA (immediate)
-	case 0xaa:	swallowRead(); TAX();							break;	// TAX (implied)
-	case 0xab:	immediate(); ATX();								break;	// *ATX (immediate)
-	case 0xac:	absolute(); LDY();								break;	// LDY (absolute)
-	case 0xad:	absolute(); LDA();								break;	// LDA (absolute)
-	case 0xae:	absolute(); LDX();								break;	// LDX (absolute)
-	case 0xaf:	absolute(); LAX();								break;	// *LAX (absolute)
-
-	case 0xb0:	immediate(); BCS();								break;	// BCS (relative)
-	case 0xb1:	indirectIndexedY(); LDA();						break;	// LDA (indirect indexed Y)
-	case 0xb2:	swallowRead(); JAM();							break;	// *JAM
-	case 0xb3:	indirectIndexedY(); LAX();						break;	// *LAX (indirect indexed Y)
-	case 0xb4:	zeroPageX(); LDY();								break;	// LDY (zero page, X)
-	case 0xb5:	zeroPageX(); LDA();								break;	// LDA (zero page, X)
-	case 0xb6:	zeroPageY(); LDX();								break;	// LDX (zero page, Y)
-	case 0xb7:	zeroPageY(); LAX();								break;	// *LAX (zero page, Y)
-	case 0xb8:	swallowRead(); CLV();							break;	// CLV (implied)
-	case 0xb9:	absoluteY(); LDA();								break;	// LDA (absolute, Y)
-	case 0xba:	swallowRead(); TSX();							break;	// TSX (implied)
-	case 0xbb:	absoluteYAddress(); maybeFixupRead(); LAS();	break;	// *LAS (absolute, Y)
-	case 0xbc:	absoluteX(); LDY();								break;	// LDY (absolute, X)
-	case 0xbd:	absoluteX(); LDA();								break;	// LDA (absolute, X)
-	case 0xbe:	absoluteY(); LDX();								break;	// LDX (absolute, Y)
-	case 0xbf:	absoluteY(); LAX();								break;	// *LAX (absolute, Y)
-
-	case 0xc0:	immediate(); CPY();								break;	// CPY (immediate)
-	case 0xc1:	indexedIndirectX(); CMP();						break;	// CMP (indexed indirect X)
-	case 0xc2:	immediate(); NOP();								break;	// *NOP (immediate)
-	case 0xc3:	indexedIndirectX(); DCP();						break;	// *DCP (indexed indirect X)
-	case 0xc4:	zeroPage(); CPY();								break;	// CPY (zero page)
-	case 0xc5:	zeroPage(); CMP();								break;	// CMP (zero page)
-	case 0xc6:	zeroPage(); DEC();								break;	// DEC (zero page)
-	case 0xc7:	zeroPage(); DCP();								break;	// *DCP (zero page)
-	case 0xc8:	swallowRead(); INY();							break;	// INY (implied)
-	case 0xc9:	immediate(); CMP();								break;	// CMP (immediate)
-	case 0xca:	swallowRead(); DEX();							break;	// DEX (implied)
-	case 0xcb:	immediate(); AXS();								break;	// *AXS (immediate)
-	case 0xcc:	absolute(); CPY();								break;	// CPY (absolute)
-	case 0xcd:	absolute(); CMP();								break;	// CMP (absolute)
-	case 0xce:	absolute(); DEC();								break;	// DEC (absolute)
-	case 0xcf:	absolute(); DCP();								break;	// *DCP (absolute)
-
-	case 0xd0:	immediate(); BNE();								break;	// BNE (relative)
-	case 0xd1:	indirectIndexedY(); CMP();						break;	// CMP (indirect indexed Y)
-	case 0xd2:	swallowRead(); JAM();							break;	// *JAM
-	case 0xd3:	indirectIndexedYAddress(); fixupRead(); DCP();	break;	// *DCP (indirect indexed Y)
-	case 0xd4:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0xd5:	zeroPageX(); CMP();								break;	// CMP (zero page, X)
-	case 0xd6:	zeroPageX(); DEC();								break;	// DEC (zero page, X)
-	case 0xd7:	zeroPageX(); DCP();								break;	// *DCP (zero page, X)
-	case 0xd8:	swallowRead(); CLD();							break;	// CLD (implied)
-	case 0xd9:	absoluteY(); CMP();								break;	// CMP (absolute, Y)
-	case 0xda:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0xdb:	absoluteYAddress(); fixupRead(); DCP();			break;	// *DCP (absolute, Y)
-	case 0xdc:	absoluteXAddress(); maybeFixupRead(); NOP();	break;	// *NOP (absolute, X)
-	case 0xdd:	absoluteX(); CMP();								break;	// CMP (absolute, X)
-	case 0xde:	absoluteXAddress(); fixupRead(); DEC();			break;	// DEC (absolute, X)
-	case 0xdf:	absoluteXAddress(); fixupRead(); DCP();			break;	// *DCP (absolute, X)
-
-	case 0xe0:	immediate(); CPX();								break;	// CPX (immediate)
-	case 0xe1:	indexedIndirectX(); SBC();						break;	// SBC (indexed indirect X)
-	case 0xe2:	immediate(); NOP();								break;	// *NOP (immediate)
-	case 0xe3:	indexedIndirectX(); ISB();						break;	// *ISB (indexed indirect X)
-	case 0xe4:	zeroPage(); CPX();								break;	// CPX (zero page)
-	case 0xe5:	zeroPage(); SBC();								break;	// SBC (zero page)
-	case 0xe6:	zeroPage(); INC();								break;	// INC (zero page)
-	case 0xe7:	zeroPage(); ISB();								break;	// *ISB (zero page)
-	case 0xe8:	swallowRead(); INX();							break;	// INX (implied)
-	case 0xe9:	immediate(); SBC();								break;	// SBC (immediate)
-	case 0xea:	swallowRead(); NOP();							break;	// NOP (implied)
-	case 0xeb:	immediate(); SBC();								break;	// *SBC (immediate)
-	case 0xec:	absolute(); CPX();								break;	// CPX (absolute)
-	case 0xed:	absolute(); SBC();								break;	// SBC (absolute)
-	case 0xee:	absolute(); INC();								break;	// INC (absolute)
-	case 0xef:	absolute(); ISB();								break;	// *ISB (absolute)
-
-	case 0xf0:	immediate(); BEQ();								break;	// BEQ (relative)
-	case 0xf1:	indirectIndexedY(); SBC();						break;	// SBC (indirect indexed Y)
-	case 0xf2:	swallowRead(); JAM();							break;	// *JAM
-	case 0xf3:	indirectIndexedYAddress(); fixupRead(); ISB();	break;	// *ISB (indirect indexed Y)
-	case 0xf4:	zeroPageX(); NOP();								break;	// *NOP (zero page, X)
-	case 0xf5:	zeroPageX(); SBC();								break;	// SBC (zero page, X)
-	case 0xf6:	zeroPageX(); INC();								break;	// INC (zero page, X)
-	case 0xf7:	zeroPageX(); ISB();								break;	// *ISB (zero page, X)
-	case 0xf8:	swallowRead(); SED();							break;	// SED (implied)
-	case 0xf9:	absoluteY(); SBC();								break;	// SBC (absolute, Y)
-	case 0xfa:	swallowRead(); NOP();							break;	// *NOP (implied)
-	case 0xfb:	absoluteYAddress(); fixupRead(); ISB();			break;	// *ISB (absolute, Y)
-	case 0xfc:	absoluteXAddress(); maybeFixupRead(); NOP();	break;	// *NOP (absolute, X)
-	case 0xfd:	absoluteX(); SBC();								break;	// SBC (absolute, X)
-	case 0xfe:	absoluteXAddress(); fixupRead(); INC();			break;	// INC (absolute, X)
-	case 0xff:	absoluteXAddress(); fixupRead(); ISB();			break;	// *ISB (absolute, X)
+	OPCODE(0x00)	swallowFetch(); BRK();							NEXT;	// BRK (implied)
+	OPCODE(0x01)	indexedIndirectX(); ORA();						NEXT;	// ORA (indexed indirect X)
+	OPCODE(0x02)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x03)	indexedIndirectX(); SLO();						NEXT;	// *SLO (indexed indirect X)
+	OPCODE(0x04)	zeroPage();	NOP();								NEXT;	// *NOP (zero page)
+	OPCODE(0x05)	zeroPage(); ORA();								NEXT;	// ORA (zero page)
+	OPCODE(0x06)	zeroPage(); ASL();								NEXT;	// ASL (zero page)
+	OPCODE(0x07)	zeroPage(); SLO();								NEXT;	// *SLO (zero page)
+	OPCODE(0x08)	swallowRead(); PHP();							NEXT;	// PHP (implied)
+	OPCODE(0x09)	immediate(); ORA();								NEXT;	// ORA (immediate)
+	OPCODE(0x0a)	swallowRead(); ASLA();							NEXT;	// ASL A (implied)
+	OPCODE(0x0b)	immediate(); ANC();								NEXT;	// *ANC (immediate)
+	OPCODE(0x0c)	absolute(); NOP(); 								NEXT;	// *NOP (absolute)
+	OPCODE(0x0d)	absolute(); ORA();								NEXT;	// ORA (absolute)
+	OPCODE(0x0e)	absolute(); ASL();								NEXT;	// ASL (absolute)
+	OPCODE(0x0f)	absolute(); SLO();								NEXT;	// *SLO (absolute)
+
+	OPCODE(0x10)	immediate(); BPL();								NEXT;	// BPL (relative)
+	OPCODE(0x11)	indirectIndexedY(); ORA();						NEXT;	// ORA (indirect indexed Y)
+	OPCODE(0x12)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x13)	indirectIndexedYAddress(); fixupRead(); SLO();	NEXT;	// *SLO (indirect indexed Y)
+	OPCODE(0x14)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0x15)	zeroPageX(); ORA();								NEXT;	// ORA (zero page, X)
+	OPCODE(0x16)	zeroPageX(); ASL();								NEXT;	// ASL (zero page, X)
+	OPCODE(0x17)	zeroPageX(); SLO();								NEXT;	// *SLO (zero page, X)
+	OPCODE(0x18)	swallowRead(); resetFlag(CF);					NEXT;	// CLC (implied)
+	OPCODE(0x19)	absoluteY(); ORA();								NEXT;	// ORA (absolute, Y)
+	OPCODE(0x1a)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0x1b)	absoluteYAddress(); fixupRead(); SLO();			NEXT;	// *SLO (absolute, Y)
+	OPCODE(0x1c)	absoluteXAddress(); maybeFixupRead();			NEXT;	// *NOP (absolute, X)
+	OPCODE(0x1d)	absoluteX(); ORA();								NEXT;	// ORA (absolute, X)
+	OPCODE(0x1e)	absoluteXAddress(); fixupRead(); ASL();			NEXT;	// ASL (absolute, X)
+	OPCODE(0x1f)	absoluteXAddress(); fixupRead(); SLO();			NEXT;	// *SLO (absolute, X)
+
+	OPCODE(0x20)	JSR();											NEXT;	// JSR (absolute)
+	OPCODE(0x21)	indexedIndirectX(); AND();						NEXT;	// AND (indexed indirect X)
+	OPCODE(0x22)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x23)	indexedIndirectX(); RLA();;						NEXT;	// *RLA (indexed indirect X)
+	OPCODE(0x24)	zeroPage(); BIT();								NEXT;	// BIT (zero page)
+	OPCODE(0x25)	zeroPage(); AND();								NEXT;	// AND (zero page)
+	OPCODE(0x26)	zeroPage(); ROL();								NEXT;	// ROL (zero page)
+	OPCODE(0x27)	zeroPage(); RLA();;								NEXT;	// *RLA (zero page)
+	OPCODE(0x28)	swallowRead(); PLP();							NEXT;	// PLP (implied)
+	OPCODE(0x29)	immediate(); AND();								NEXT;	// AND (immediate)
+	OPCODE(0x2a)	swallowRead(); ROLA();							NEXT;	// ROL A (implied)
+	OPCODE(0x2b)	immediate(); ANC();								NEXT;	// *ANC (immediate)
+	OPCODE(0x2c)	absolute(); BIT();								NEXT;	// BIT (absolute)
+	OPCODE(0x2d)	absolute(); AND();								NEXT;	// AND (absolute)
+	OPCODE(0x2e)	absolute(); ROL();								NEXT;	// ROL (absolute)
+	OPCODE(0x2f)	absolute(); RLA();;								NEXT;	// *RLA (absolute)
+
+	OPCODE(0x30)	immediate(); BMI();								NEXT;	// BMI (relative)
+	OPCODE(0x31)	indirectIndexedY(); AND();						NEXT;	// AND (indirect indexed Y)
+	OPCODE(0x32)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x33)	indirectIndexedYAddress(); fixupRead(); RLA();	NEXT;	// *RLA (indirect indexed Y)
+	OPCODE(0x34)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0x35)	zeroPageX(); AND();								NEXT;	// AND (zero page, X)
+	OPCODE(0x36)	zeroPageX(); ROL();								NEXT;	// ROL (zero page, X)
+	OPCODE(0x37)	zeroPageX(); RLA();;							NEXT;	// *RLA (zero page, X)
+	OPCODE(0x38)	swallowRead(); SEC();							NEXT;	// SEC (implied)
+	OPCODE(0x39)	absoluteY(); AND();								NEXT;	// AND (absolute, Y)
+	OPCODE(0x3a)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0x3b)	absoluteYAddress(); fixupRead(); RLA();			NEXT;	// *RLA (absolute, Y)
+	OPCODE(0x3c)	absoluteXAddress(); maybeFixupRead(); NOP();	NEXT;	// *NOP (absolute, X)
+	OPCODE(0x3d)	absoluteX(); AND();								NEXT;	// AND (absolute, X)
+	OPCODE(0x3e)	absoluteXAddress(); fixupRead(); ROL();			NEXT;	// ROL (absolute, X)
+	OPCODE(0x3f)	absoluteXAddress(); fixupRead(); RLA();         NEXT;	// *RLA (absolute, X)
+
+	OPCODE(0x40)	swallowRead(); RTI();							NEXT;	// RTI (implied)
+	OPCODE(0x41)	indexedIndirectX(); EOR();						NEXT;	// EOR (indexed indirect X)
+	OPCODE(0x42)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x43)	indexedIndirectX(); SRE();						NEXT;	// *SRE (indexed indirect X)
+	OPCODE(0x44)	zeroPage();	NOP();								NEXT;	// *NOP (zero page)
+	OPCODE(0x45)	zeroPage(); EOR();								NEXT;	// EOR (zero page)
+	OPCODE(0x46)	zeroPage(); LSR();								NEXT;	// LSR (zero page)
+	OPCODE(0x47)	zeroPage(); SRE();								NEXT;	// *SRE (zero page)
+	OPCODE(0x48)	swallowRead(); PHA();							NEXT;	// PHA (implied)
+	OPCODE(0x49)	immediate(); EOR();								NEXT;	// EOR (immediate)
+	OPCODE(0x4a)	swallowRead(); LSRA();							NEXT;	// LSR A (implied)
+	OPCODE(0x4b)	immediate(); ASR();								NEXT;	// *ASR (immediate)
+	OPCODE(0x4c)	absoluteAddress(); JMP();						NEXT;	// JMP (absolute)
+	OPCODE(0x4d)	absolute(); EOR();								NEXT;	// EOR (absolute)
+	OPCODE(0x4e)	absolute(); LSR(); 								NEXT;	// LSR (absolute)
+	OPCODE(0x4f)	absolute(); SRE();								NEXT;	// *SRE (absolute)
+
+	OPCODE(0x50)	immediate(); BVC();								NEXT;	// BVC (relative)
+	OPCODE(0x51)	indirectIndexedY(); EOR();						NEXT;	// EOR (indirect indexed Y)
+	OPCODE(0x52)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x53)	indirectIndexedYAddress(); fixupRead(); SRE();	NEXT;	// *SRE (indirect indexed Y)
+	OPCODE(0x54)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0x55)	zeroPageX(); EOR();								NEXT;	// EOR (zero page, X)
+	OPCODE(0x56)	zeroPageX(); LSR(); 							NEXT;	// LSR (zero page, X)
+	OPCODE(0x57)	zeroPageX(); SRE();								NEXT;	// *SRE (zero page, X)
+	OPCODE(0x58)	swallowRead(); CLI();							NEXT;	// CLI (implied)
+	OPCODE(0x59)	absoluteY(); EOR();								NEXT;	// EOR (absolute, Y)
+	OPCODE(0x5a)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0x5b)	absoluteYAddress(); fixupRead(); SRE();			NEXT;	// *SRE (absolute, Y)
+	OPCODE(0x5c)	absoluteXAddress(); maybeFixupRead(); NOP();	NEXT;	// *NOP (absolute, X)
+	OPCODE(0x5d)	absoluteX(); EOR();								NEXT;	// EOR (absolute, X)
+	OPCODE(0x5e)	absoluteXAddress(); fixupRead(); LSR();			NEXT;	// LSR (absolute, X)
+	OPCODE(0x5f)	absoluteXAddress(); fixupRead(); SRE();			NEXT;	// *SRE (absolute, X)
+
+	OPCODE(0x60)	swallowRead(); RTS();							NEXT;	// RTS (implied)
+	OPCODE(0x61)	indexedIndirectX(); ADC<Variant>();				NEXT;	// ADC (indexed indirect X)
+	OPCODE(0x62)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x63)	indexedIndirectX(); RRA<Variant>();				NEXT;	// *RRA (indexed indirect X)
+	OPCODE(0x64)	zeroPage();	NOP();								NEXT;	// *NOP (zero page)
+	OPCODE(0x65)	zeroPage(); ADC<Variant>();						NEXT;	// ADC (zero page)
+	OPCODE(0x66)	zeroPage(); ROR();								NEXT;	// ROR (zero page)
+	OPCODE(0x67)	zeroPage(); RRA<Variant>();						NEXT;	// *RRA (zero page)
+	OPCODE(0x68)	swallowRead(); PLA();							NEXT;	// PLA (implied)
+	OPCODE(0x69)	immediate(); ADC<Variant>();					NEXT;	// ADC (immediate)
+	OPCODE(0x6a)	swallowRead(); RORA();							NEXT;	// ROR A (implied)
+	OPCODE(0x6b)	immediate(); ARR<Variant>();					NEXT;	// *ARR (immediate)
+	OPCODE(0x6c)	indirectAddress(); JMP();						NEXT;	// JMP (indirect)
+	OPCODE(0x6d)	absolute(); ADC<Variant>();						NEXT;	// ADC (absolute)
+	OPCODE(0x6e)	absolute(); ROR(); 								NEXT;	// ROR (absolute)
+	OPCODE(0x6f)	absolute(); RRA<Variant>();						NEXT;	// *RRA (absolute)
+
+	OPCODE(0x70)	immediate(); BVS();								NEXT;	// BVS (relative)
+	OPCODE(0x71)	indirectIndexedY(); ADC<Variant>();				NEXT;	// ADC (indirect indexed Y)
+	OPCODE(0x72)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x73)	indirectIndexedYAddress(); fixupRead(); RRA<Variant>();	NEXT;	// *RRA (indirect indexed Y)
+	OPCODE(0x74)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0x75)	zeroPageX(); ADC<Variant>();					NEXT;	// ADC (zero page, X)
+	OPCODE(0x76)	zeroPageX(); ROR(); 							NEXT;	// ROR (zero page, X)
+	OPCODE(0x77)	zeroPageX(); RRA<Variant>();					NEXT;	// *RRA (zero page, X)
+	OPCODE(0x78)	swallowRead(); SEI();							NEXT;	// SEI (implied)
+	OPCODE(0x79)	absoluteY(); ADC<Variant>();					NEXT;	// ADC (absolute, Y)
+	OPCODE(0x7a)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0x7b)	absoluteYAddress(); fixupRead(); RRA<Variant>();	NEXT;	// *RRA (absolute, Y)
+	OPCODE(0x7c)	absoluteXAddress(); maybeFixupRead(); NOP();	NEXT;	// *NOP (absolute, X)
+	OPCODE(0x7d)	absoluteX(); ADC<Variant>();					NEXT;	// ADC (absolute, X)
+	OPCODE(0x7e)	absoluteXAddress(); fixupRead(); ROR();			NEXT;	// ROR (absolute, X)
+	OPCODE(0x7f)	absoluteXAddress(); fixupRead(); RRA<Variant>();	NEXT;	// *RRA (absolute, X)
+
+	OPCODE(0x80)	immediate(); NOP();								NEXT;	// *NOP (immediate)
+	OPCODE(0x81)	indexedIndirectXAddress(); STA();				NEXT;	// STA (indexed indirect X)
+	OPCODE(0x82)	immediate(); NOP();								NEXT;	// *NOP (immediate)
+	OPCODE(0x83)	indexedIndirectXAddress(); SAX();				NEXT;	// *SAX (indexed indirect X)
+	OPCODE(0x84)	zeroPageAddress(); STY();						NEXT;	// STY (zero page)
+	OPCODE(0x85)	zeroPageAddress(); STA();						NEXT;	// STA (zero page)
+	OPCODE(0x86)	zeroPageAddress(); STX();						NEXT;	// STX (zero page)
+	OPCODE(0x87)	zeroPageAddress(); SAX();						NEXT;	// *SAX (zero page)
+	OPCODE(0x88)	swallowRead(); DEY();							NEXT;	// DEY (implied)
+	OPCODE(0x89)	immediate(); NOP();								NEXT;	// *NOP (immediate)
+	OPCODE(0x8a)	swallowRead(); TXA();							NEXT;	// TXA (implied)
+	OPCODE(0x8b)	immediate(); ANE();								NEXT;	// *ANE (immediate)
+	OPCODE(0x8c)	absoluteAddress(); STY();						NEXT;	// STY (absolute)
+	OPCODE(0x8d)	absoluteAddress(); STA();						NEXT;	// STA (absolute)
+	OPCODE(0x8e)	absoluteAddress(); STX();						NEXT;	// STX (absolute)
+	OPCODE(0x8f)	absoluteAddress(); SAX();						NEXT;	// *SAX (absolute)
+
+	OPCODE(0x90)	immediate(); BCC();								NEXT;	// BCC (relative)
+	OPCODE(0x91)	indirectIndexedYAddress(); fixup(); STA();		NEXT;	// STA (indirect indexed Y)
+	OPCODE(0x92)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0x93)	indirectIndexedYAddress(); fixup(); SHA();		NEXT;	// *SHA (indirect indexed, Y)
+	OPCODE(0x94)	zeroPageXAddress(); STY();						NEXT;	// STY (zero page, X)
+	OPCODE(0x95)	zeroPageXAddress(); STA();						NEXT;	// STA (zero page, X)
+	OPCODE(0x96)	zeroPageYAddress(); STX();						NEXT;	// STX (zero page, Y)
+	OPCODE(0x97)	zeroPageYAddress(); SAX();						NEXT;	// *SAX (zero page, Y)
+	OPCODE(0x98)	swallowRead(); TYA();							NEXT;	// TYA (implied)
+	OPCODE(0x99)	absoluteYAddress(); fixup(); STA();				NEXT;	// STA (absolute, Y)
+	OPCODE(0x9a)	swallowRead(); TXS();							NEXT;	// TXS (implied)
+	OPCODE(0x9b)	absoluteYAddress(); fixup(); TAS();				NEXT;	// *TAS (absolute, Y)
+	OPCODE(0x9c)	absoluteXAddress(); fixup(); SYA();				NEXT;	// *SYA (absolute, X)
+	OPCODE(0x9d)	absoluteXAddress(); fixup(); STA();				NEXT;	// STA (absolute, X)
+	OPCODE(0x9e)	absoluteYAddress(); fixup(); SXA();				NEXT;	// *SXA (absolute, Y)
+	OPCODE(0x9f)	absoluteYAddress(); fixup(); SHA();				NEXT;	// *SHA (absolute, Y)
+
+	OPCODE(0xa0)	immediate(); LDY();								NEXT;	// LDY (immediate)
+	OPCODE(0xa1)	indexedIndirectX(); LDA();						NEXT;	// LDA (indexed indirect X)
+	OPCODE(0xa2)	immediate(); LDX();								NEXT;	// LDX (immediate)
+	OPCODE(0xa3)	indexedIndirectX(); LAX();						NEXT;	// *LAX (indexed indirect X)
+	OPCODE(0xa4)	zeroPage(); LDY();								NEXT;	// LDY (zero page)
+	OPCODE(0xa5)	zeroPage(); LDA();								NEXT;	// LDA (zero page)
+	OPCODE(0xa6)	zeroPage(); LDX();								NEXT;	// LDX (zero page)
+	OPCODE(0xa7)	zeroPage(); LAX();								NEXT;	// *LAX (zero page)
+	OPCODE(0xa8)	swallowRead(); TAY();							NEXT;	// TAY (implied)
+	OPCODE(0xa9)	immediate(); LDA();								NEXT;	// LDA (immediate)
+	OPCODE(0xaa)	swallowRead(); TAX();							NEXT;	// TAX (implied)
+	OPCODE(0xab)	immediate(); ATX();								NEXT;	// *ATX (immediate)
+	OPCODE(0xac)	absolute(); LDY();								NEXT;	// LDY (absolute)
+	OPCODE(0xad)	absolute(); LDA();								NEXT;	// LDA (absolute)
+	OPCODE(0xae)	absolute(); LDX();								NEXT;	// LDX (absolute)
+	OPCODE(0xaf)	absolute(); LAX();								NEXT;	// *LAX (absolute)
+
+	OPCODE(0xb0)	immediate(); BCS();								NEXT;	// BCS (relative)
+	OPCODE(0xb1)	indirectIndexedY(); LDA();						NEXT;	// LDA (indirect indexed Y)
+	OPCODE(0xb2)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0xb3)	indirectIndexedY(); LAX();						NEXT;	// *LAX (indirect indexed Y)
+	OPCODE(0xb4)	zeroPageX(); LDY();								NEXT;	// LDY (zero page, X)
+	OPCODE(0xb5)	zeroPageX(); LDA();								NEXT;	// LDA (zero page, X)
+	OPCODE(0xb6)	zeroPageY(); LDX();								NEXT;	// LDX (zero page, Y)
+	OPCODE(0xb7)	zeroPageY(); LAX();								NEXT;	// *LAX (zero page, Y)
+	OPCODE(0xb8)	swallowRead(); CLV();							NEXT;	// CLV (implied)
+	OPCODE(0xb9)	absoluteY(); LDA();								NEXT;	// LDA (absolute, Y)
+	OPCODE(0xba)	swallowRead(); TSX();							NEXT;	// TSX (implied)
+	OPCODE(0xbb)	absoluteYAddress(); maybeFixupRead(); LAS();	NEXT;	// *LAS (absolute, Y)
+	OPCODE(0xbc)	absoluteX(); LDY();								NEXT;	// LDY (absolute, X)
+	OPCODE(0xbd)	absoluteX(); LDA();								NEXT;	// LDA (absolute, X)
+	OPCODE(0xbe)	absoluteY(); LDX();								NEXT;	// LDX (absolute, Y)
+	OPCODE(0xbf)	absoluteY(); LAX();								NEXT;	// *LAX (absolute, Y)
+
+	OPCODE(0xc0)	immediate(); CPY();								NEXT;	// CPY (immediate)
+	OPCODE(0xc1)	indexedIndirectX(); CMP();						NEXT;	// CMP (indexed indirect X)
+	OPCODE(0xc2)	immediate(); NOP();								NEXT;	// *NOP (immediate)
+	OPCODE(0xc3)	indexedIndirectX(); DCP();						NEXT;	// *DCP (indexed indirect X)
+	OPCODE(0xc4)	zeroPage(); CPY();								NEXT;	// CPY (zero page)
+	OPCODE(0xc5)	zeroPage(); CMP();								NEXT;	// CMP (zero page)
+	OPCODE(0xc6)	zeroPage(); DEC();								NEXT;	// DEC (zero page)
+	OPCODE(0xc7)	zeroPage(); DCP();								NEXT;	// *DCP (zero page)
+	OPCODE(0xc8)	swallowRead(); INY();							NEXT;	// INY (implied)
+	OPCODE(0xc9)	immediate(); CMP();								NEXT;	// CMP (immediate)
+	OPCODE(0xca)	swallowRead(); DEX();							NEXT;	// DEX (implied)
+	OPCODE(0xcb)	immediate(); AXS();								NEXT;	// *AXS (immediate)
+	OPCODE(0xcc)	absolute(); CPY();								NEXT;	// CPY (absolute)
+	OPCODE(0xcd)	absolute(); CMP();								NEXT;	// CMP (absolute)
+	OPCODE(0xce)	absolute(); DEC();								NEXT;	// DEC (absolute)
+	OPCODE(0xcf)	absolute(); DCP();								NEXT;	// *DCP (absolute)
+
+	OPCODE(0xd0)	immediate(); BNE();								NEXT;	// BNE (relative)
+	OPCODE(0xd1)	indirectIndexedY(); CMP();						NEXT;	// CMP (indirect indexed Y)
+	OPCODE(0xd2)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0xd3)	indirectIndexedYAddress(); fixupRead(); DCP();	NEXT;	// *DCP (indirect indexed Y)
+	OPCODE(0xd4)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0xd5)	zeroPageX(); CMP();								NEXT;	// CMP (zero page, X)
+	OPCODE(0xd6)	zeroPageX(); DEC();								NEXT;	// DEC (zero page, X)
+	OPCODE(0xd7)	zeroPageX(); DCP();								NEXT;	// *DCP (zero page, X)
+	OPCODE(0xd8)	swallowRead(); CLD();							NEXT;	// CLD (implied)
+	OPCODE(0xd9)	absoluteY(); CMP();								NEXT;	// CMP (absolute, Y)
+	OPCODE(0xda)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0xdb)	absoluteYAddress(); fixupRead(); DCP();			NEXT;	// *DCP (absolute, Y)
+	OPCODE(0xdc)	absoluteXAddress(); maybeFixupRead(); NOP();	NEXT;	// *NOP (absolute, X)
+	OPCODE(0xdd)	absoluteX(); CMP();								NEXT;	// CMP (absolute, X)
+	OPCODE(0xde)	absoluteXAddress(); fixupRead(); DEC();			NEXT;	// DEC (absolute, X)
+	OPCODE(0xdf)	absoluteXAddress(); fixupRead(); DCP();			NEXT;	// *DCP (absolute, X)
+
+	OPCODE(0xe0)	immediate(); CPX();								NEXT;	// CPX (immediate)
+	OPCODE(0xe1)	indexedIndirectX(); SBC<Variant>();				NEXT;	// SBC (indexed indirect X)
+	OPCODE(0xe2)	immediate(); NOP();								NEXT;	// *NOP (immediate)
+	OPCODE(0xe3)	indexedIndirectX(); ISB<Variant>();				NEXT;	// *ISB (indexed indirect X)
+	OPCODE(0xe4)	zeroPage(); CPX();								NEXT;	// CPX (zero page)
+	OPCODE(0xe5)	zeroPage(); SBC<Variant>();						NEXT;	// SBC (zero page)
+	OPCODE(0xe6)	zeroPage(); INC();								NEXT;	// INC (zero page)
+	OPCODE(0xe7)	zeroPage(); ISB<Variant>();						NEXT;	// *ISB (zero page)
+	OPCODE(0xe8)	swallowRead(); INX();							NEXT;	// INX (implied)
+	OPCODE(0xe9)	immediate(); SBC<Variant>();					NEXT;	// SBC (immediate)
+	OPCODE(0xea)	swallowRead(); NOP();							NEXT;	// NOP (implied)
+	OPCODE(0xeb)	immediate(); SBC<Variant>();					NEXT;	// *SBC (immediate)
+	OPCODE(0xec)	absolute(); CPX();								NEXT;	// CPX (absolute)
+	OPCODE(0xed)	absolute(); SBC<Variant>();						NEXT;	// SBC (absolute)
+	OPCODE(0xee)	absolute(); INC();								NEXT;	// INC (absolute)
+	OPCODE(0xef)	absolute(); ISB<Variant>();						NEXT;	// *ISB (absolute)
+
+	OPCODE(0xf0)	immediate(); BEQ();								NEXT;	// BEQ (relative)
+	OPCODE(0xf1)	indirectIndexedY(); SBC<Variant>();				NEXT;	// SBC (indirect indexed Y)
+	OPCODE(0xf2)	swallowRead(); JAM();							NEXT;	// *JAM
+	OPCODE(0xf3)	indirectIndexedYAddress(); fixupRead(); ISB<Variant>();	NEXT;	// *ISB (indirect indexed Y)
+	OPCODE(0xf4)	zeroPageX(); NOP();								NEXT;	// *NOP (zero page, X)
+	OPCODE(0xf5)	zeroPageX(); SBC<Variant>();					NEXT;	// SBC (zero page, X)
+	OPCODE(0xf6)	zeroPageX(); INC();								NEXT;	// INC (zero page, X)
+	OPCODE(0xf7)	zeroPageX(); ISB<Variant>();					NEXT;	// *ISB (zero page, X)
+	OPCODE(0xf8)	swallowRead(); SED();							NEXT;	// SED (implied)
+	OPCODE(0xf9)	absoluteY(); SBC<Variant>();					NEXT;	// SBC (absolute, Y)
+	OPCODE(0xfa)	swallowRead(); NOP();							NEXT;	// *NOP (implied)
+	OPCODE(0xfb)	absoluteYAddress(); fixupRead(); ISB<Variant>();	NEXT;	// *ISB (absolute, Y)
+	OPCODE(0xfc)	absoluteXAddress(); maybeFixupRead(); NOP();	NEXT;	// *NOP (absolute, X)
+	OPCODE(0xfd)	absoluteX(); SBC<Variant>();					NEXT;	// SBC (absolute, X)
+	OPCODE(0xfe)	absoluteXAddress(); fixupRead(); INC();			NEXT;	// INC (absolute, X)
+	OPCODE(0xff)	absoluteXAddress(); fixupRead(); ISB<Variant>();	NEXT;	// *ISB (absolute, X)
 	}
 }
 
+#undef OPCODE
+#undef NEXT
+#ifdef EIGHTBIT_THREADED_DISPATCH
+#	undef HANDLER
+#	undef HANDLERS
+#endif
+
 void EightBit::MOS6502::push(uint8_t value) noexcept {
 	lowerStack();
 	base::memoryWrite(value);
@@ -635,6 +878,8 @@ void EightBit::MOS6502::branch(bool condition) noexcept {
 	if (condition) {
 		int8_t relative = BUS().DATA();
 		swallowRead();
+		if (m_quiet)
+			tick();		// Branch taken
 		fixupBranch(relative);
 		JMP();
 	}
@@ -770,8 +1015,12 @@ void EightBit::MOS6502::ROR() {
 
 #pragma region Undocumented instructions with BCD effects
 
+template<class Variant>
 void EightBit::MOS6502::ARR() {
-	denary() != 0 ? decimalARR() : binaryARR();
+	if constexpr (Variant::Decimal)
+		denary() != 0 ? decimalARR() : binaryARR();
+	else
+		binaryARR();
 }
 
 uint8_t EightBit::MOS6502::coreARR() {
@@ -879,9 +1128,10 @@ void EightBit::MOS6502::ASR() {
 	LSRA();
 }
 
+template<class Variant>
 void EightBit::MOS6502::ISB() {
 	INC();
-	SBC();
+	SBC<Variant>();
 }
 
 void EightBit::MOS6502::RLA() {
@@ -889,9 +1139,10 @@ void EightBit::MOS6502::RLA() {
 	AND();
 }
 
+template<class Variant>
 void EightBit::MOS6502::RRA() {
 	ROR();
-	ADC();
+	ADC<Variant>();
 }
 
 void EightBit::MOS6502::SLO() {
@@ -912,3 +1163,6 @@ void EightBit::MOS6502::DCP() {
 #pragma endregion
 
 #pragma endregion
+
+template void EightBit::MOS6502::dispatch<EightBit::NMOS>() noexcept;
+template void EightBit::MOS6502::dispatch<EightBit::Ricoh>() noexcept;
@@ -66,4 +66,6 @@ void Board::initialise() noexcept {
 
 	poke(0x00, 0x4c);
 	CPU().pokeShort(1, m_configuration.getStartAddress());
+
+	remap();
 }
@@ -23,14 +23,14 @@ public:
 	void initialise() noexcept final;
 
 protected:
-	virtual constexpr const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final {
+	virtual EightBit::MemoryMapping mapping(uint16_t address) noexcept final {
 		return m_mapping;
 	}
 
 private:
 	const Configuration& m_configuration;
 	EightBit::Ram m_ram = 0x10000;
-	EightBit::MOS6502 m_cpu = *this;
+	EightBit::MOS6502 m_cpu{ *this, EightBit::MOS6502::mode_t::Fast };
 	EightBit::Symbols m_symbols;
 	EightBit::Disassembly m_disassembler = { *this, m_cpu, m_symbols };
 	const EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
@@ -15,6 +15,8 @@ int main(int argc, char* argv[]) {
 #endif
 
 	EightBit::TestHarness<Configuration, Board> harness(configuration);
+	if (!harness.parse(argc, argv))
+		return 1;
 	harness.run();
 
 	return 0;
@@ -0,0 +1,162 @@
+#include "stdafx.h"
+#include "Configuration.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include <EventArgs.h>
+#include <mos6502.h>
+
+// Runs the functional test twice, interpreted and then translated, and checks
+// that both pass, and that both were in the same state at every checkpoint.
+
+namespace {
+
+	constexpr uint64_t Budget = 100'000'000;	// The test passes in a little over 96M cycles
+	constexpr uint64_t Interval = 1'000'000;
+	constexpr uint8_t Passed = 0xf0;			// The last test's number, at 0x200
+
+	struct state_t {
+		uint64_t cycle = 0;
+		uint16_t pc = 0;
+		uint8_t a = 0;
+		uint8_t x = 0;
+		uint8_t y = 0;
+		uint8_t s = 0;
+		uint8_t p = 0;
+		uint32_t memory = 0;	// A hash of all of it
+
+		[[nodiscard]] bool operator==(const state_t& rhs) const noexcept {
+			return
+				cycle == rhs.cycle && pc == rhs.pc
+				&& a == rhs.a && x == rhs.x && y == rhs.y && s == rhs.s && p == rhs.p
+				&& memory == rhs.memory;
+		}
+
+		[[nodiscard]] bool operator!=(const state_t& rhs) const noexcept { return !(*this == rhs); }
+	};
+
+	std::ostream& operator<<(std::ostream& output, const state_t& state) {
+		return output
+			<< std::dec << "cycle=" << state.cycle << std::hex << std::setfill('0')
+			<< " PC=" << std::setw(4) << state.pc
+			<< " A=" << std::setw(2) << (int)state.a
+			<< " X=" << std::setw(2) << (int)state.x
+			<< " Y=" << std::setw(2) << (int)state.y
+			<< " S=" << std::setw(2) << (int)state.s
+			<< " P=" << std::setw(2) << (int)state.p
+			<< " memory=" << std::setw(8) << state.memory;
+	}
+
+	// Unobserved, so that translated blocks are allowed to run
+	class Machine final : public EightBit::Bus {
+	public:
+		Machine(const Configuration& configuration, const bool translated)
+		: m_configuration(configuration) {
+			if (translated)
+				m_cpu.translate(true);
+		}
+
+		[[nodiscard]] constexpr auto& CPU() noexcept { return m_cpu; }
+		[[nodiscard]] constexpr const auto& checkpoints() const noexcept { return m_checkpoints; }
+
+		void raisePOWER() noexcept final {
+			EightBit::Bus::raisePOWER();
+			CPU().raisePOWER();
+			CPU().raiseRESET();
+			CPU().raiseINT();
+			CPU().raiseNMI();
+			CPU().raiseSO();
+			CPU().raiseRDY();
+		}
+
+		void lowerPOWER() noexcept final {
+			CPU().lowerPOWER();
+			EightBit::Bus::lowerPOWER();
+		}
+
+		void initialise() noexcept final {
+			m_ram.load(m_configuration.getRomDirectory() + "/" + m_configuration.getProgram(), m_configuration.getLoadAddress().joined);
+			poke(0x00, 0x4c);
+			CPU().pokeShort(1, m_configuration.getStartAddress());
+			remap();
+
+			// Events also bound translated blocks, so both runs stop on the same instructions
+			scheduler().every(Interval, [this](EightBit::EventArgs&) {
+				m_checkpoints.push_back(state());
+			});
+		}
+
+		[[nodiscard]] state_t state() noexcept {
+			state_t returned;
+			returned.cycle = scheduler().now();
+			returned.pc = CPU().PC().joined;
+			returned.a = CPU().A();
+			returned.x = CPU().X();
+			returned.y = CPU().Y();
+			returned.s = CPU().S();
+			returned.p = CPU().P();
+			uint32_t hash = 2166136261;
+			for (int address = 0; address < 0x10000; ++address)
+				hash = (hash ^ peek(static_cast<uint16_t>(address))) * 16777619;
+			returned.memory = hash;
+			return returned;
+		}
+
+	protected:
+		EightBit::MemoryMapping mapping(uint16_t) noexcept final {
+			return m_mapping;
+		}
+
+	private:
+		const Configuration& m_configuration;
+		EightBit::Ram m_ram = 0x10000;
+		EightBit::MOS6502 m_cpu{ *this, EightBit::MOS6502::mode_t::Fast };
+		const EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+		std::vector<state_t> m_checkpoints;
+	};
+
+	[[nodiscard]] std::vector<state_t> run(const Configuration& configuration, const bool translated) {
+		Machine machine(configuration, translated);
+		machine.initialise();
+		machine.raisePOWER();
+		machine.CPU().runUntil(Budget);
+		auto checkpoints = machine.checkpoints();
+		checkpoints.push_back(machine.state());
+		const auto test = machine.peek(0x0200);
+		if (test != Passed)
+			std::cout << (translated ? "Translated" : "Interpreted") << " run failed, at test " << std::hex << (int)test << std::endl;
+		return test == Passed ? checkpoints : std::vector<state_t>{};
+	}
+}
+
+int main() {
+
+	if (!EightBit::Translator::Supported) {
+		std::cout << "The translator isn't supported here" << std::endl;
+		return EXIT_SUCCESS;
+	}
+
+	const Configuration configuration;
+
+	const auto interpreted = run(configuration, false);
+	const auto translated = run(configuration, true);
+	if (interpreted.empty() || translated.empty())
+		return EXIT_FAILURE;
+
+	if (interpreted.size() != translated.size()) {
+		std::cout << "Interpreted run has " << interpreted.size() << " checkpoints, translated " << translated.size() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < interpreted.size(); ++i) {
+		if (interpreted[i] != translated[i]) {
+			std::cout << "Interpreted: " << interpreted[i] << std::endl;
+			std::cout << "Translated:  " << translated[i] << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << "Interpreted and translated runs match, at " << std::dec << interpreted.size() << " checkpoints" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+#include "stdafx.h"
+
+#include <cstdlib>
+
+#include <mos6502.h>
+#include <Ricoh2A03.h>
+
+// Checks that each processor does its arithmetic as its own variant, whether
+// the instruction is stepped to, or run directly with "execute".  In decimal
+// mode, 09 + 01 is 10 on an NMOS 6502, but 0a on a Ricoh 2A03.
+
+namespace {
+
+	constexpr uint16_t Start = 0x0200;
+	constexpr uint16_t Result = 0x0010;
+
+	// SED; CLC; LDA #$09; ADC #$01; STA $10; JMP *
+	constexpr uint8_t Program[] = { 0xf8, 0x18, 0xa9, 0x09, 0x69, 0x01, 0x85, 0x10, 0x4c, 0x08, 0x02 };
+
+	template<class Processor>
+	class Machine final : public EightBit::Bus {
+	public:
+		[[nodiscard]] constexpr auto& CPU() noexcept { return m_cpu; }
+
+		void raisePOWER() noexcept final {
+			EightBit::Bus::raisePOWER();
+			CPU().raisePOWER();
+			CPU().lowerRESET();
+			CPU().raiseINT();
+			CPU().raiseNMI();
+			CPU().raiseSO();
+			CPU().raiseRDY();
+		}
+
+		void lowerPOWER() noexcept final {
+			CPU().lowerPOWER();
+			EightBit::Bus::lowerPOWER();
+		}
+
+		void initialise() noexcept final {
+			for (size_t i = 0; i < sizeof(Program); ++i)
+				poke(static_cast<uint16_t>(Start + i), Program[i]);
+			CPU().pokeShort(0xfffc, Start);
+			remap();
+		}
+
+	protected:
+		EightBit::MemoryMapping mapping(uint16_t) noexcept final {
+			return m_mapping;
+		}
+
+	private:
+		EightBit::Ram m_ram = 0x10000;
+		Processor m_cpu{ *this };
+		const EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+	};
+
+	template<class Processor>
+	[[nodiscard]] uint8_t stepped() {
+		Machine<Processor> machine;
+		machine.initialise();
+		machine.raisePOWER();
+		machine.CPU().step();
+		machine.CPU().raiseRESET();
+		for (int i = 0; i < 10; ++i)
+			machine.CPU().step();
+		return machine.peek(Result);
+	}
+
+	// Just the ADC #$01, with the decimal flag already set
+	template<class Processor>
+	[[nodiscard]] uint8_t executed() {
+		Machine<Processor> machine;
+		machine.initialise();
+		machine.raisePOWER();
+		machine.CPU().step();
+		machine.CPU().raiseRESET();
+		machine.CPU().A() = 0x09;
+		machine.CPU().P() = EightBit::MOS6502::DF;
+		machine.CPU().PC() = Start + 5;
+		static_cast<EightBit::Processor&>(machine.CPU()).execute(0x69);
+		return machine.CPU().A();
+	}
+
+	[[nodiscard]] bool check(const char* what, const uint8_t actual, const uint8_t expected) {
+		const auto passed = actual == expected;
+		if (!passed)
+			std::cout << what << ": " << std::hex << (int)actual << ", expected " << (int)expected << std::endl;
+		return passed;
+	}
+}
+
+int main() {
+
+	auto passed = true;
+	passed &= check("MOS6502, stepped", stepped<EightBit::MOS6502>(), 0x10);
+	passed &= check("MOS6502, executed", executed<EightBit::MOS6502>(), 0x10);
+	passed &= check("Ricoh2A03, stepped", stepped<EightBit::Ricoh2A03>(), 0x0a);
+	passed &= check("Ricoh2A03, executed", executed<EightBit::Ricoh2A03>(), 0x0a);
+	if (!passed)
+		return EXIT_FAILURE;
+
+	std::cout << "Each variant's decimal arithmetic matches, stepped and executed" << std::endl;
+	return EXIT_SUCCESS;
+}
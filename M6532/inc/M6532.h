@@ -181,7 +181,7 @@
 namespace EightBit {
 	class M6532 final : public ClockedChip {
 	public:
-		M6532();
+		M6532(Scheduler& scheduler);
 		virtual ~M6532() = default;
 
 		/*     ___
@@ -211,6 +211,7 @@ namespace EightBit {
 		*/
 		DECLARE_PIN_OUTPUT(IRQ)
 
+	public:
 		/*
 		Data Bus (D0-D7)
 		The 6532 has eight bi-directional data pins (D0-D7). These pins connect to the system's data lines and
@@ -253,14 +254,20 @@ namespace EightBit {
 		// CHIP SELECT 2, active low
 		DECLARE_PIN_INPUT(CS2)
 
+	public:
 		bool activated() { return powered() && selected(); }
 		bool selected() { return raised(CS1()) && lowered(CS2()); }
 
 		Signal<EventArgs> Accessing;
 		Signal<EventArgs> Accessed;
 
+	protected:
+		void advance(uint64_t cycles) noexcept final;
+
 	private:
-		void step();
+		[[nodiscard]] bool countDown(uint64_t cycles) noexcept;
+		void scheduleTimer() noexcept;
+		void access();
 
 		void reset();
 
@@ -287,13 +294,13 @@ namespace EightBit {
 
 		Ram m_ram = 0x80;
 
-		bool m_allowTimerInterrupts;
-		bool m_allowPA7Interrupts;
+		bool m_allowTimerInterrupts = false;
+		bool m_allowPA7Interrupts = false;
 		EdgeDetect m_edgeDetection;
 
-		TimerIncrement m_timerIncrement;
-		uint8_t m_currentIncrement;
-		uint8_t m_timerInterval;
+		TimerIncrement m_timerIncrement = One;
+		int m_currentIncrement = One;
+		uint8_t m_timerInterval = 0;
 		bool m_timerInterrupt;
 
 		uint8_t m_interruptFlags;
@@ -3,10 +3,24 @@
 
 #include <cassert>
 
-EightBit::M6532::M6532() {
-	Ticked.connect([this](EightBit::EventArgs&) {
-		step();
-	});
+EightBit::M6532::M6532(Scheduler& scheduler)
+: ClockedChip(scheduler) {
+
+	// The chip is clocked lazily, from the machine's scheduler.  It is brought
+	// up to date and accessed as it is selected, or as R/W changes whilst it is,
+	// so the data bus is driven within the same bus cycle.
+	const auto accessing = [this](EightBit::EventArgs&) {
+		if (activated()) {
+			catchUp();
+			access();
+			scheduleTimer();
+		}
+	};
+	RaisedCS1.connect(accessing);
+	LoweredCS2.connect(accessing);
+	RaisedRW.connect(accessing);
+	LoweredRW.connect(accessing);
+	RaisedPOWER.connect(accessing);
 }
 
 DEFINE_PIN_LEVEL_CHANGERS(RES, M6532);
@@ -16,36 +30,65 @@ DEFINE_PIN_LEVEL_CHANGERS(RS, M6532);
 DEFINE_PIN_LEVEL_CHANGERS(CS1, M6532);
 DEFINE_PIN_LEVEL_CHANGERS(CS2, M6532);
 
-void EightBit::M6532::step() {
+void EightBit::M6532::advance(const uint64_t cycles) noexcept {
 
 	resetCycles();
 
-	if (!activated())
-		return;
-
-	Accessing.fire();
-
-	if (lowered(RES())) {
-		reset();
-		raise(RES());
+	if (!powered())
 		return;
-	}
 
-	if (--m_currentIncrement == 0) {
-		m_currentIncrement = m_timerIncrement;
-		--m_timerInterval;
-	}
+	const bool expired = countDown(cycles);
 
 	const bool interruptPA7 = m_allowPA7Interrupts && (PA() & Bit7);
 	if (interruptPA7)
 		IF() = setBit(IF(), Bit6);
 
-	const bool interruptTimer = m_allowTimerInterrupts && (m_timerInterval == 0);
+	const bool interruptTimer = m_allowTimerInterrupts && expired;
 	if (interruptTimer)
 		IF() = setBit(IF(), Bit7);
 
 	match(IRQ(), !(interruptPA7 || interruptTimer));
 
+	scheduleTimer();
+}
+
+// Runs the interval timer for a number of cycles, returning
+// true if it was at zero at any point during that time.
+bool EightBit::M6532::countDown(uint64_t cycles) noexcept {
+
+	const bool zero = m_timerInterval == 0;
+
+	if (cycles < static_cast<uint64_t>(m_currentIncrement)) {
+		m_currentIncrement -= static_cast<int>(cycles);
+		return zero;
+	}
+
+	cycles -= m_currentIncrement;
+	const auto decrements = 1 + cycles / m_timerIncrement;
+	m_currentIncrement = m_timerIncrement - static_cast<int>(cycles % m_timerIncrement);
+
+	const bool expired = zero || (decrements >= m_timerInterval);
+	m_timerInterval = static_cast<uint8_t>(m_timerInterval - decrements);
+	return expired;
+}
+
+// If the timer could interrupt, make sure we're around when it does
+void EightBit::M6532::scheduleTimer() noexcept {
+	if (!m_allowTimerInterrupts || (m_timerInterval == 0))
+		return;
+	schedule(m_currentIncrement + static_cast<uint64_t>(m_timerInterval - 1) * m_timerIncrement);
+}
+
+void EightBit::M6532::access() {
+
+	Accessing.fire();
+
+	if (lowered(RES())) {
+		reset();
+		raise(RES());
+		return;
+	}
+
 	const auto read = raised(RW());
 	const auto write = lowered(RW());
 	assert(read == !write);
@@ -127,4 +170,6 @@ void EightBit::M6532::reset() {
 	PA() = m_dra = m_ddra = 0;	// Zero port A registers
 	PB() = m_drb = m_ddrb = 0;	// Zero port B registers
 	m_allowTimerInterrupts = m_allowPA7Interrupts = false; // Interrupts are disabled
+	IF() = 0;
+	raise(IRQ());
 }
@@ -64,6 +64,69 @@ namespace EightBit {
 			CF = Bit0,
 		};
 
+		// What an indexed addressing postbyte asks for, shared with the disassembler
+
+		enum class index_t : uint8_t {
+			Invalid,
+			Register,	// ,R (and the auto increment/decrement forms)
+			Offset5,	// n,R (five-bit, held in the postbyte)
+			B,			// B,R
+			A,			// A,R
+			D,			// D,R
+			Offset8,	// n,R (eight-bit)
+			Offset16,	// n,R (sixteen-bit)
+			Relative8,	// n,PCR (eight-bit)
+			Relative16,	// n,PCR (sixteen-bit)
+			Extended,	// [n]
+		};
+
+		struct index_mode_t {
+
+			index_t offset = index_t::Invalid;
+			uint8_t reg = 0;			// Base register, as "RR" numbers them
+			int8_t adjust = 0;			// Post-increment (,R+ ,R++) or pre-decrement (,-R ,--R)
+			int8_t displacement = 0;	// Five-bit offset
+			bool indirect = false;
+			uint8_t current = 0;		// Extra cycles: reads of the program counter...
+			uint8_t idle = 0;			// ... then of the idle bus
+
+			constexpr index_mode_t() noexcept {}
+
+			constexpr index_mode_t(const uint8_t postbyte) noexcept
+			: reg((postbyte & (Bit6 | Bit5)) >> 5) {
+
+				if ((postbyte & Bit7) == 0) {
+					offset = index_t::Offset5;
+					displacement = signExtend(5, postbyte & Mask5);
+					current = idle = 1;
+					return;
+				}
+
+				indirect = (postbyte & Bit4) != 0;
+				switch (postbyte & Mask4) {
+				case 0b0000: offset = index_t::Register; adjust = 1; current = 1; idle = 2; break;	// ,R+
+				case 0b0001: offset = index_t::Register; adjust = 2; current = 1; idle = 3; break;	// ,R++
+				case 0b0010: offset = index_t::Register; adjust = -1; current = 1; idle = 2; break;	// ,-R
+				case 0b0011: offset = index_t::Register; adjust = -2; current = 1; idle = 3; break;	// ,--R
+				case 0b0100: offset = index_t::Register; current = 1; break;						// ,R
+				case 0b0101: offset = index_t::B; current = 1; idle = 1; break;						// B,R
+				case 0b0110: offset = index_t::A; current = 1; idle = 1; break;						// A,R
+				case 0b1000: offset = index_t::Offset8; idle = 1; break;							// n,R (eight-bit)
+				case 0b1001: offset = index_t::Offset16; current = 1; idle = 2; break;				// n,R (sixteen-bit)
+				case 0b1011: offset = index_t::D; current = 3; idle = 2; break;						// D,R
+				case 0b1100: offset = index_t::Relative8; idle = 1; break;							// n,PCR (eight-bit)
+				case 0b1101: offset = index_t::Relative16; current = 1; idle = 3; break;			// n,PCR (sixteen-bit)
+				case 0b1111: offset = index_t::Extended; current = 1; break;						// [n]
+				default:
+					break;
+				}
+			}
+		};
+
+		[[nodiscard]] static constexpr const auto& indexMode(const uint8_t postbyte) noexcept {
+			return m_indexModes[postbyte];
+		}
+
 		mc6809(Bus& bus);
 
 		void execute() noexcept final;
@@ -136,6 +199,8 @@ namespace EightBit {
 		void handleRESET() noexcept final;
 		void handleINT() noexcept final;
 
+		[[nodiscard]] bool spinning() noexcept final { return halted(); }
+
 		// Bus reader/writers
 
 		void memoryRead() noexcept override;
@@ -176,9 +241,24 @@ namespace EightBit {
 
 		// Execution helpers
 
-		void executeUnprefixed();
-		void execute10();
-		void execute11();
+		typedef void (*instruction_t)(mc6809&);
+
+		// Unprefixed, then the pages prefixed by 0x10 and 0x11
+		static const std::array<std::array<instruction_t, 0x100>, 3> m_instructions;
+
+		template<void (mc6809::*Address)(), void (mc6809::*Operation)()>
+		static void instruction(mc6809& cpu) {
+			(cpu.*Address)();
+			(cpu.*Operation)();
+		}
+
+		template<void (mc6809::*Operation)()>
+		static void instruction(mc6809& cpu) {
+			(cpu.*Operation)();
+		}
+
+		void inherent() { swallowCurrent(); }
+		static void illegal(mc6809&) { UNREACHABLE; }
 
 		void prefix10();
 		void prefix11();
@@ -568,7 +648,15 @@ namespace EightBit {
 		uint8_t m_dp = 0;
 		uint8_t m_cc = 0;
 
-		bool m_prefix10 = false;
-		bool m_prefix11 = false;
+		uint8_t m_page = 0;	// Of "m_instructions", chosen by any prefix
+
+		static const std::array<index_mode_t, 0x100> m_indexModes;
 	};
+
+	inline constexpr std::array<mc6809::index_mode_t, 0x100> mc6809::m_indexModes = [] {
+		std::array<index_mode_t, 0x100> modes;
+		for (int i = 0; i < 0x100; ++i)
+			modes[i] = index_mode_t(i);
+		return modes;
+	}();
 }
\ No newline at end of file
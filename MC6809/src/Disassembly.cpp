@@ -657,101 +657,83 @@ std::string EightBit::Disassembly::Address_indexed(std::string mnemomic) {
 	std::ostringstream output;
 
 	const auto type = getByte(++m_address);
-	const auto r = RR((type & (Chip::Bit6 | Chip::Bit5)) >> 5);
+	const auto& mode = mc6809::indexMode(type);
+	const auto r = RR(mode.reg);
+	const auto indirect = mode.indirect;
 
 	uint8_t byte = 0xff;
 	uint16_t word = 0xffff;
 
 	output << dump_ByteValue(type);
 
-	if (type & Chip::Bit7) {
-		const auto indirect = type & Chip::Bit4;
-		switch (type & Chip::Mask4) {
-		case 0b0000:	// ,R+
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("," + r + "+", indirect);
-			break;
-		case 0b0001:	// ,R++
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("," + r + "++", indirect);
-			break;
-		case 0b0010:	// ,-R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(",-" + r, indirect);
-			break;
-		case 0b0011:	// ,--R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(",--" + r, indirect);
-			break;
-		case 0b0100:	// ,R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("," + r, indirect);
-			break;
-		case 0b0101:	// B,R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("B," + r, indirect);
-			break;
-		case 0b0110:	// A,R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("A," + r, indirect);
-			break;
-		case 0b1000:	// n,R (eight-bit)
-			byte = getByte(++m_address);
-			output
-				<< dump_ByteValue(byte)
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(dump_ByteValue(byte) + "," + r, indirect);
-			break;
-		case 0b1001:	// n,R (sixteen-bit)
-			word = getShort(++m_address);
-			output
-				<< dump_WordValue(word)
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(dump_WordValue(word) + "," + r, indirect);
-			break;
-		case 0b1011:	// D,R
-			output
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect("D," + r, indirect);
-			break;
-		case 0b1100:	// n,PCR (eight-bit)
-			byte = getByte(++m_address);
-			output
-				<< dump_ByteValue(byte)
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(dump_RelativeValue((int8_t)byte) + ",PCR", indirect);
-			break;
-		case 0b1101:	// n,PCR (sixteen-bit)
-			word = getShort(++m_address);
-			output
-				<< dump_WordValue(word)
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(dump_RelativeValue((int16_t)word) + ",PCR", indirect);
-			break;
-		case 0b1111:	// [n]
-			assert(indirect);
-			word = getShort(++m_address);
-			output
-				<< dump_WordValue(word)
-				<< "\t" << mnemomic << "\t"
-				<< wrapIndirect(dump_WordValue(word), indirect);
-			break;
-		default:
-			assert(false);
-			break;
-		}
-	} else {
-		// EA = ,R + 5-bit offset
+	switch (mode.offset) {
+	case mc6809::index_t::Register: {	// ,R ,R+ ,R++ ,-R ,--R
+		const std::string decrement(mode.adjust < 0 ? -mode.adjust : 0, '-');
+		const std::string increment(mode.adjust > 0 ? mode.adjust : 0, '+');
 		output
 			<< "\t" << mnemomic << "\t"
-			<< (int)Processor::signExtend(5, type & Chip::Mask5) << "," << r;
+			<< wrapIndirect("," + decrement + r + increment, indirect);
+		break;
+	}
+	case mc6809::index_t::Offset5:	// EA = ,R + 5-bit offset
+		output
+			<< "\t" << mnemomic << "\t"
+			<< (int)mode.displacement << "," << r;
+		break;
+	case mc6809::index_t::B:		// B,R
+		output
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect("B," + r, indirect);
+		break;
+	case mc6809::index_t::A:		// A,R
+		output
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect("A," + r, indirect);
+		break;
+	case mc6809::index_t::D:		// D,R
+		output
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect("D," + r, indirect);
+		break;
+	case mc6809::index_t::Offset8:	// n,R (eight-bit)
+		byte = getByte(++m_address);
+		output
+			<< dump_ByteValue(byte)
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect(dump_ByteValue(byte) + "," + r, indirect);
+		break;
+	case mc6809::index_t::Offset16:	// n,R (sixteen-bit)
+		word = getShort(++m_address);
+		output
+			<< dump_WordValue(word)
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect(dump_WordValue(word) + "," + r, indirect);
+		break;
+	case mc6809::index_t::Relative8:	// n,PCR (eight-bit)
+		byte = getByte(++m_address);
+		output
+			<< dump_ByteValue(byte)
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect(dump_RelativeValue((int8_t)byte) + ",PCR", indirect);
+		break;
+	case mc6809::index_t::Relative16:	// n,PCR (sixteen-bit)
+		word = getShort(++m_address);
+		output
+			<< dump_WordValue(word)
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect(dump_RelativeValue((int16_t)word) + ",PCR", indirect);
+		break;
+	case mc6809::index_t::Extended:	// [n]
+		assert(indirect);
+		word = getShort(++m_address);
+		output
+			<< dump_WordValue(word)
+			<< "\t" << mnemomic << "\t"
+			<< wrapIndirect(dump_WordValue(word), indirect);
+		break;
+	default:
+		assert(false);
+		break;
 	}
 
 	return output.str();
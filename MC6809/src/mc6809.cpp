@@ -44,7 +44,7 @@ void EightBit::mc6809::swallowSpin(int ticks) {
 }
 
 void EightBit::mc6809::poweredStep() noexcept {
-	m_prefix10 = m_prefix11 = false;
+	m_page = 0;
 	if (halted())
 		handleHALT();
 	else if (lowered(RESET()))
@@ -63,6 +63,7 @@ void EightBit::mc6809::poweredStep() noexcept {
 
 void EightBit::mc6809::handleRESET() noexcept {
 	base::handleRESET();
+	raiseRESET();
 	raiseNMI();
 	lowerBA();
 	raiseBS();
@@ -90,6 +91,7 @@ void EightBit::mc6809::handleINT() noexcept {
 void EightBit::mc6809::handleHALT() noexcept {
 	raiseBA();
 	raiseBS();
+	tick();		// The clock keeps running, even though the bus is idle
 }
 
 void EightBit::mc6809::handleNMI() noexcept {
@@ -141,483 +143,471 @@ void EightBit::mc6809::memoryRead() noexcept {
 void EightBit::mc6809::execute() noexcept {
 	lowerBA();
 	lowerBS();
-	if (m_prefix10) {
-		execute10();
-	} else if (m_prefix11) {
-		execute11();
-	} else {
-		executeUnprefixed();
-	}
+	m_instructions[m_page][opcode()](*this);
 }
 
-void EightBit::mc6809::executeUnprefixed() {
+// Each instruction is specialised for its addressing mode at compile time
+
+constexpr std::array<std::array<EightBit::mc6809::instruction_t, 0x100>, 3> EightBit::mc6809::m_instructions = [] {
+
+	std::array<std::array<instruction_t, 0x100>, 3> pages;
+	for (auto& page : pages)
+		page.fill(&mc6809::illegal);
 
-	switch (opcode()) {
+	auto& unprefixed = pages[0];
+	auto& page10 = pages[1];
+	auto& page11 = pages[2];
 
-	case 0x10:	prefix10();	break;
-	case 0x11:	prefix11();	break;
+	// Unprefixed
+
+	unprefixed[0x10] = &mc6809::instruction<&mc6809::prefix10>;
+	unprefixed[0x11] = &mc6809::instruction<&mc6809::prefix11>;
 
 	// ABX
-	case 0x3a:	swallowCurrent(); ABX(); break;			// ABX (inherent)
+	unprefixed[0x3a] = &mc6809::instruction<&mc6809::inherent, &mc6809::ABX>;	// ABX (inherent)
 
 	// ADC
-	case 0x89:	immediateByte(); ADCA(); break;			// ADC (ADCA immediate)
-	case 0x99:	directByte(); ADCA(); break;			// ADC (ADCA direct)
-	case 0xa9:	indexedByte(); ADCA(); break;			// ADC (ADCA indexed)
-	case 0xb9:	extendedByte(); ADCA(); break;			// ADC (ADCA extended)
+	unprefixed[0x89] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ADCA>;	// ADC (ADCA immediate)
+	unprefixed[0x99] = &mc6809::instruction<&mc6809::directByte, &mc6809::ADCA>;	// ADC (ADCA direct)
+	unprefixed[0xa9] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ADCA>;	// ADC (ADCA indexed)
+	unprefixed[0xb9] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ADCA>;	// ADC (ADCA extended)
 
-	case 0xc9:	immediateByte(); ADCB(); break;			// ADC (ADCB immediate)
-	case 0xd9:	directByte(); ADCB(); break;			// ADC (ADCB direct)
-	case 0xe9:	indexedByte(); ADCB(); break;			// ADC (ADCB indexed)
-	case 0xf9:	extendedByte(); ADCB(); break;			// ADC (ADCB extended)
+	unprefixed[0xc9] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ADCB>;	// ADC (ADCB immediate)
+	unprefixed[0xd9] = &mc6809::instruction<&mc6809::directByte, &mc6809::ADCB>;	// ADC (ADCB direct)
+	unprefixed[0xe9] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ADCB>;	// ADC (ADCB indexed)
+	unprefixed[0xf9] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ADCB>;	// ADC (ADCB extended)
 
 	// ADD
-	case 0x8b:	immediateByte(); ADDA(); break;			// ADD (ADDA immediate)
-	case 0x9b:	directByte(); ADDA(); break;			// ADD (ADDA direct)
-	case 0xab:	indexedByte(); ADDA(); break;			// ADD (ADDA indexed)
-	case 0xbb:	extendedByte(); ADDA(); break;			// ADD (ADDA extended)
+	unprefixed[0x8b] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ADDA>;	// ADD (ADDA immediate)
+	unprefixed[0x9b] = &mc6809::instruction<&mc6809::directByte, &mc6809::ADDA>;	// ADD (ADDA direct)
+	unprefixed[0xab] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ADDA>;	// ADD (ADDA indexed)
+	unprefixed[0xbb] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ADDA>;	// ADD (ADDA extended)
 
-	case 0xcb:	immediateByte(); ADDB(); break;			// ADD (ADDB immediate)
-	case 0xdb:	directByte(); ADDB(); break;			// ADD (ADDB direct)
-	case 0xeb:	indexedByte(); ADDB(); break;			// ADD (ADDB indexed)
-	case 0xfb:	extendedByte(); ADDB(); break;			// ADD (ADDB extended)
+	unprefixed[0xcb] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ADDB>;	// ADD (ADDB immediate)
+	unprefixed[0xdb] = &mc6809::instruction<&mc6809::directByte, &mc6809::ADDB>;	// ADD (ADDB direct)
+	unprefixed[0xeb] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ADDB>;	// ADD (ADDB indexed)
+	unprefixed[0xfb] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ADDB>;	// ADD (ADDB extended)
 
-	case 0xc3:	immediateShort(); ADDD(); break;		// ADD (ADDD immediate)
-	case 0xd3:	directShort(); ADDD(); break;			// ADD (ADDD direct)
-	case 0xe3:	indexedShort(); ADDD(); break;			// ADD (ADDD indexed)
-	case 0xf3:	extendedShort(); ADDD();break;			// ADD (ADDD extended)
+	unprefixed[0xc3] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::ADDD>;	// ADD (ADDD immediate)
+	unprefixed[0xd3] = &mc6809::instruction<&mc6809::directShort, &mc6809::ADDD>;	// ADD (ADDD direct)
+	unprefixed[0xe3] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::ADDD>;	// ADD (ADDD indexed)
+	unprefixed[0xf3] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::ADDD>;	// ADD (ADDD extended)
 
 	// AND
-	case 0x84: immediateByte(); ANDA(); break;			// AND (ANDA immediate)
-	case 0x94: directByte(); ANDA(); break;				// AND (ANDA direct)
-	case 0xa4: indexedByte(); ANDA(); break;			// AND (ANDA indexed)
-	case 0xb4: extendedByte(); ANDA(); break;			// AND (ANDA extended)
+	unprefixed[0x84] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ANDA>;	// AND (ANDA immediate)
+	unprefixed[0x94] = &mc6809::instruction<&mc6809::directByte, &mc6809::ANDA>;	// AND (ANDA direct)
+	unprefixed[0xa4] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ANDA>;	// AND (ANDA indexed)
+	unprefixed[0xb4] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ANDA>;	// AND (ANDA extended)
 
-	case 0xc4: immediateByte(); ANDB(); break;			// AND (ANDB immediate)
-	case 0xd4: directByte(); ANDB(); break;				// AND (ANDB direct)
-	case 0xe4: indexedByte(); ANDB(); break;			// AND (ANDB indexed)
-	case 0xf4: extendedByte(); ANDB(); break;			// AND (ANDB extended)
+	unprefixed[0xc4] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ANDB>;	// AND (ANDB immediate)
+	unprefixed[0xd4] = &mc6809::instruction<&mc6809::directByte, &mc6809::ANDB>;	// AND (ANDB direct)
+	unprefixed[0xe4] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ANDB>;	// AND (ANDB indexed)
+	unprefixed[0xf4] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ANDB>;	// AND (ANDB extended)
 
-	case 0x1c: immediateByte(); ANDCC(); break;			// AND (ANDCC immediate)
+	unprefixed[0x1c] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ANDCC>;	// AND (ANDCC immediate)
 
 	// ASL/LSL
-	case 0x08: directByte(); ASL(); break;				// ASL (direct)
-	case 0x48: swallowCurrent(); ASLA(); break;			// ASL (ASLA inherent)
-	case 0x58: swallowCurrent(); ASLB(); break;			// ASL (ASLB inherent)
-	case 0x68: indexedByte(); ASL(); break;				// ASL (indexed)
-	case 0x78: extendedByte(); ASL(); break;			// ASL (extended)
+	unprefixed[0x08] = &mc6809::instruction<&mc6809::directByte, &mc6809::ASL>;	// ASL (direct)
+	unprefixed[0x48] = &mc6809::instruction<&mc6809::inherent, &mc6809::ASLA>;	// ASL (ASLA inherent)
+	unprefixed[0x58] = &mc6809::instruction<&mc6809::inherent, &mc6809::ASLB>;	// ASL (ASLB inherent)
+	unprefixed[0x68] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ASL>;	// ASL (indexed)
+	unprefixed[0x78] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ASL>;	// ASL (extended)
 
 	// ASR
-	case 0x07: directByte(); ASR(); break;				// ASR (direct)
-	case 0x47: swallowCurrent(); ASRA(); break;			// ASR (ASRA inherent)
-	case 0x57: swallowCurrent(); ASRB(); break;			// ASR (ASRB inherent)
-	case 0x67: indexedByte(); ASR(); break;				// ASR (indexed)
-	case 0x77: extendedByte(); ASR(); break;			// ASR (extended)
+	unprefixed[0x07] = &mc6809::instruction<&mc6809::directByte, &mc6809::ASR>;	// ASR (direct)
+	unprefixed[0x47] = &mc6809::instruction<&mc6809::inherent, &mc6809::ASRA>;	// ASR (ASRA inherent)
+	unprefixed[0x57] = &mc6809::instruction<&mc6809::inherent, &mc6809::ASRB>;	// ASR (ASRB inherent)
+	unprefixed[0x67] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ASR>;	// ASR (indexed)
+	unprefixed[0x77] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ASR>;	// ASR (extended)
 
 	// BIT
-	case 0x85: immediateByte(); BITA(); break;			// BIT (BITA immediate)
-	case 0x95: directByte(); BITA(); break;				// BIT (BITA direct)
-	case 0xa5: indexedByte(); BITA(); break;			// BIT (BITA indexed)
-	case 0xb5: extendedByte(); BITA(); break;			// BIT (BITA extended)
+	unprefixed[0x85] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::BITA>;	// BIT (BITA immediate)
+	unprefixed[0x95] = &mc6809::instruction<&mc6809::directByte, &mc6809::BITA>;	// BIT (BITA direct)
+	unprefixed[0xa5] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::BITA>;	// BIT (BITA indexed)
+	unprefixed[0xb5] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::BITA>;	// BIT (BITA extended)
 
-	case 0xc5: immediateByte(); BITB(); break;			// BIT (BITB immediate)
-	case 0xd5: directByte(); BITB(); break;				// BIT (BITB direct)
-	case 0xe5: indexedByte(); BITB(); break;			// BIT (BITB indexed)
-	case 0xf5: extendedByte(); BITB(); break;			// BIT (BITB extended)
+	unprefixed[0xc5] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::BITB>;	// BIT (BITB immediate)
+	unprefixed[0xd5] = &mc6809::instruction<&mc6809::directByte, &mc6809::BITB>;	// BIT (BITB direct)
+	unprefixed[0xe5] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::BITB>;	// BIT (BITB indexed)
+	unprefixed[0xf5] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::BITB>;	// BIT (BITB extended)
 
 	// CLR
-	case 0x0f: directAddress(); CLR(); break;			// CLR (direct)
-	case 0x4f: swallowCurrent(); CLRA(); break;			// CLR (CLRA implied)
-	case 0x5f: swallowCurrent(); CLRB(); break;			// CLR (CLRB implied)
-	case 0x6f: indexedAddress(); CLR(); break;			// CLR (indexed)
-	case 0x7f: extendedAddress(); CLR(); break;			// CLR (extended)
+	unprefixed[0x0f] = &mc6809::instruction<&mc6809::directAddress, &mc6809::CLR>;	// CLR (direct)
+	unprefixed[0x4f] = &mc6809::instruction<&mc6809::inherent, &mc6809::CLRA>;	// CLR (CLRA implied)
+	unprefixed[0x5f] = &mc6809::instruction<&mc6809::inherent, &mc6809::CLRB>;	// CLR (CLRB implied)
+	unprefixed[0x6f] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::CLR>;	// CLR (indexed)
+	unprefixed[0x7f] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::CLR>;	// CLR (extended)
 
 	// CMP
 
 	// CMPA
-	case 0x81: immediateByte(); CMPA(); break;			// CMP (CMPA, immediate)
-	case 0x91: directByte(); CMPA(); break;				// CMP (CMPA, direct)
-	case 0xa1: indexedByte(); CMPA(); break;			// CMP (CMPA, indexed)
-	case 0xb1: extendedByte(); CMPA(); break;			// CMP (CMPA, extended)
+	unprefixed[0x81] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::CMPA>;	// CMP (CMPA, immediate)
+	unprefixed[0x91] = &mc6809::instruction<&mc6809::directByte, &mc6809::CMPA>;	// CMP (CMPA, direct)
+	unprefixed[0xa1] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::CMPA>;	// CMP (CMPA, indexed)
+	unprefixed[0xb1] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::CMPA>;	// CMP (CMPA, extended)
 
 	// CMPB
-	case 0xc1: immediateByte(); CMPB(); break;			// CMP (CMPB, immediate)
-	case 0xd1: directByte(); CMPB(); break;				// CMP (CMPB, direct)
-	case 0xe1: indexedByte(); CMPB(); break;			// CMP (CMPB, indexed)
-	case 0xf1: extendedByte(); CMPB(); break;			// CMP (CMPB, extended)
+	unprefixed[0xc1] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::CMPB>;	// CMP (CMPB, immediate)
+	unprefixed[0xd1] = &mc6809::instruction<&mc6809::directByte, &mc6809::CMPB>;	// CMP (CMPB, direct)
+	unprefixed[0xe1] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::CMPB>;	// CMP (CMPB, indexed)
+	unprefixed[0xf1] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::CMPB>;	// CMP (CMPB, extended)
 
 	// CMPX
-	case 0x8c: immediateShort(); CMPX(); break;			// CMP (CMPX, immediate)
-	case 0x9c: directShort(); CMPX(); break;			// CMP (CMPX, direct)
-	case 0xac: indexedShort(); CMPX(); break;			// CMP (CMPX, indexed)
-	case 0xbc: extendedShort(); CMPX(); break;			// CMP (CMPX, extended)
+	unprefixed[0x8c] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::CMPX>;	// CMP (CMPX, immediate)
+	unprefixed[0x9c] = &mc6809::instruction<&mc6809::directShort, &mc6809::CMPX>;	// CMP (CMPX, direct)
+	unprefixed[0xac] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::CMPX>;	// CMP (CMPX, indexed)
+	unprefixed[0xbc] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::CMPX>;	// CMP (CMPX, extended)
 
 	// COM
-	case 0x03: directByte(); COM(); break;				// COM (direct)
-	case 0x43: swallowCurrent(); COMA(); break;			// COM (COMA inherent)
-	case 0x53: swallowCurrent(); COMB(); break;			// COM (COMB inherent)
-	case 0x63: indexedByte(); COM(); break;				// COM (indexed)
-	case 0x73: extendedByte(); COM(); break;			// COM (extended)
+	unprefixed[0x03] = &mc6809::instruction<&mc6809::directByte, &mc6809::COM>;	// COM (direct)
+	unprefixed[0x43] = &mc6809::instruction<&mc6809::inherent, &mc6809::COMA>;	// COM (COMA inherent)
+	unprefixed[0x53] = &mc6809::instruction<&mc6809::inherent, &mc6809::COMB>;	// COM (COMB inherent)
+	unprefixed[0x63] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::COM>;	// COM (indexed)
+	unprefixed[0x73] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::COM>;	// COM (extended)
 
 	// CWAI
-	case 0x3c: immediateByte(); CWAI(); break;			// CWAI (immediate) - cycles omitted: halts before full interrupt response
+	unprefixed[0x3c] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::CWAI>;	// CWAI (immediate) - cycles omitted: halts before full interrupt response
 
 	// DAA
-	case 0x19: swallowCurrent(); DAA(); break;			// DAA (inherent)
+	unprefixed[0x19] = &mc6809::instruction<&mc6809::inherent, &mc6809::DAA>;	// DAA (inherent)
 
 	// DEC
-	case 0x0a: directByte(); DEC(); break;				// DEC (direct)
-	case 0x4a: swallowCurrent(); DECA(); break;			// DEC (DECA inherent)
-	case 0x5a: swallowCurrent(); DECB(); break;			// DEC (DECB inherent)
-	case 0x6a: indexedByte(); DEC(); break;				// DEC (indexed)
-	case 0x7a: extendedByte(); DEC(); break;			// DEC (extended)
+	unprefixed[0x0a] = &mc6809::instruction<&mc6809::directByte, &mc6809::DEC>;	// DEC (direct)
+	unprefixed[0x4a] = &mc6809::instruction<&mc6809::inherent, &mc6809::DECA>;	// DEC (DECA inherent)
+	unprefixed[0x5a] = &mc6809::instruction<&mc6809::inherent, &mc6809::DECB>;	// DEC (DECB inherent)
+	unprefixed[0x6a] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::DEC>;	// DEC (indexed)
+	unprefixed[0x7a] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::DEC>;	// DEC (extended)
 
 	// EOR
 
 	// EORA
-	case 0x88: immediateByte(); EORA(); break;			// EOR (EORA immediate)
-	case 0x98: directByte(); EORA(); break;				// EOR (EORA direct)
-	case 0xa8: indexedByte(); EORA(); break;			// EOR (EORA indexed)
-	case 0xb8: extendedByte(); EORA(); break;			// EOR (EORA extended)
+	unprefixed[0x88] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::EORA>;	// EOR (EORA immediate)
+	unprefixed[0x98] = &mc6809::instruction<&mc6809::directByte, &mc6809::EORA>;	// EOR (EORA direct)
+	unprefixed[0xa8] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::EORA>;	// EOR (EORA indexed)
+	unprefixed[0xb8] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::EORA>;	// EOR (EORA extended)
 
 	// EORB
-	case 0xc8: immediateByte(); EORB(); break;			// EOR (EORB immediate)
-	case 0xd8: directByte(); EORB(); break;				// EOR (EORB direct)
-	case 0xe8: indexedByte(); EORB(); break;			// EOR (EORB indexed)
-	case 0xf8: extendedByte(); EORB(); break;			// EOR (EORB extended)
+	unprefixed[0xc8] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::EORB>;	// EOR (EORB immediate)
+	unprefixed[0xd8] = &mc6809::instruction<&mc6809::directByte, &mc6809::EORB>;	// EOR (EORB direct)
+	unprefixed[0xe8] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::EORB>;	// EOR (EORB indexed)
+	unprefixed[0xf8] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::EORB>;	// EOR (EORB extended)
 
 	// EXG
-	case 0x1e: immediateByte(); EXG(); break;			// EXG (R1,R2 immediate)
+	unprefixed[0x1e] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::EXG>;	// EXG (R1,R2 immediate)
 
 	// INC
-	case 0x0c: directByte(); INC(); break;				// INC (direct)
-	case 0x4c: swallowCurrent(); INCA(); break;			// INC (INCA inherent)
-	case 0x5c: swallowCurrent(); INCB(); break;			// INC (INCB inherent)
-	case 0x6c: indexedByte(); INC(); break;				// INC (indexed)
-	case 0x7c: extendedByte(); INC(); break;			// INC (extended)
+	unprefixed[0x0c] = &mc6809::instruction<&mc6809::directByte, &mc6809::INC>;	// INC (direct)
+	unprefixed[0x4c] = &mc6809::instruction<&mc6809::inherent, &mc6809::INCA>;	// INC (INCA inherent)
+	unprefixed[0x5c] = &mc6809::instruction<&mc6809::inherent, &mc6809::INCB>;	// INC (INCB inherent)
+	unprefixed[0x6c] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::INC>;	// INC (indexed)
+	unprefixed[0x7c] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::INC>;	// INC (extended)
 
 	// JMP
-	case 0x0e: directAddress(); JMP(); break;			// JMP (direct)
-	case 0x6e: indexedAddress(); JMP(); break;			// JMP (indexed)
-	case 0x7e: extendedAddress(); JMP(); break;			// JMP (extended)
+	unprefixed[0x0e] = &mc6809::instruction<&mc6809::directAddress, &mc6809::JMP>;	// JMP (direct)
+	unprefixed[0x6e] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::JMP>;	// JMP (indexed)
+	unprefixed[0x7e] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::JMP>;	// JMP (extended)
 
 	// JSR
-	case 0x9d: directAddress(); JSR(); break;			// JSR (direct)
-	case 0xad: indexedAddress(); JSR(); break;			// JSR (indexed)
-	case 0xbd: extendedAddress(); JSR(); break;			// JSR (extended)
+	unprefixed[0x9d] = &mc6809::instruction<&mc6809::directAddress, &mc6809::JSR>;	// JSR (direct)
+	unprefixed[0xad] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::JSR>;	// JSR (indexed)
+	unprefixed[0xbd] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::JSR>;	// JSR (extended)
 
 	// LD
 
 	// LDA
-	case 0x86: immediateByte(); LDA(); break;			// LD (LDA immediate)
-	case 0x96: directByte(); LDA(); break;				// LD (LDA direct)
-	case 0xa6: indexedByte(); LDA(); break;				// LD (LDA indexed)
-	case 0xb6: extendedByte(); LDA(); break;			// LD (LDA extended)
+	unprefixed[0x86] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::LDA>;	// LD (LDA immediate)
+	unprefixed[0x96] = &mc6809::instruction<&mc6809::directByte, &mc6809::LDA>;	// LD (LDA direct)
+	unprefixed[0xa6] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::LDA>;	// LD (LDA indexed)
+	unprefixed[0xb6] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::LDA>;	// LD (LDA extended)
 
 	// LDB
-	case 0xc6: immediateByte(); LDB(); break;			// LD (LDB immediate)
-	case 0xd6: directByte(); LDB(); break;				// LD (LDB direct)
-	case 0xe6: indexedByte(); LDB(); break;				// LD (LDB indexed)
-	case 0xf6: extendedByte(); LDB(); break;			// LD (LDB extended)
+	unprefixed[0xc6] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::LDB>;	// LD (LDB immediate)
+	unprefixed[0xd6] = &mc6809::instruction<&mc6809::directByte, &mc6809::LDB>;	// LD (LDB direct)
+	unprefixed[0xe6] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::LDB>;	// LD (LDB indexed)
+	unprefixed[0xf6] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::LDB>;	// LD (LDB extended)
 
 	// LDD
-	case 0xcc: immediateShort(); LDD(); break;			// LD (LDD immediate)
-	case 0xdc: directShort(); LDD(); break;				// LD (LDD direct)
-	case 0xec: indexedShort(); LDD(); break;			// LD (LDD indexed)
-	case 0xfc: extendedShort(); LDD(); break;			// LD (LDD extended)
+	unprefixed[0xcc] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::LDD>;	// LD (LDD immediate)
+	unprefixed[0xdc] = &mc6809::instruction<&mc6809::directShort, &mc6809::LDD>;	// LD (LDD direct)
+	unprefixed[0xec] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::LDD>;	// LD (LDD indexed)
+	unprefixed[0xfc] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::LDD>;	// LD (LDD extended)
 
 	// LDU
-	case 0xce: immediateShort(); LDU(); break;			// LD (LDU immediate)
-	case 0xde: directShort(); LDU(); break;				// LD (LDU direct)
-	case 0xee: indexedShort(); LDU(); break;			// LD (LDU indexed)
-	case 0xfe: extendedShort(); LDU(); break;			// LD (LDU extended)
+	unprefixed[0xce] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::LDU>;	// LD (LDU immediate)
+	unprefixed[0xde] = &mc6809::instruction<&mc6809::directShort, &mc6809::LDU>;	// LD (LDU direct)
+	unprefixed[0xee] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::LDU>;	// LD (LDU indexed)
+	unprefixed[0xfe] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::LDU>;	// LD (LDU extended)
 
 	// LDX
-	case 0x8e: immediateShort(); LDX(); break;			// LD (LDX immediate)
-	case 0x9e: directShort(); LDX(); break;				// LD (LDX direct)
-	case 0xae: indexedShort(); LDX(); break;			// LD (LDX indexed)
-	case 0xbe: extendedShort(); LDX(); break;			// LD (LDX extended)
+	unprefixed[0x8e] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::LDX>;	// LD (LDX immediate)
+	unprefixed[0x9e] = &mc6809::instruction<&mc6809::directShort, &mc6809::LDX>;	// LD (LDX direct)
+	unprefixed[0xae] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::LDX>;	// LD (LDX indexed)
+	unprefixed[0xbe] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::LDX>;	// LD (LDX extended)
 
 	// LEA
-	case 0x30: indexedAddress(); LEAX(); break;			// LEA (LEAX indexed)
-	case 0x31: indexedAddress(); LEAY(); break;			// LEA (LEAY indexed)
-	case 0x32: indexedAddress(); LEAS(); break;			// LEA (LEAS indexed)
-	case 0x33: indexedAddress(); LEAU(); break;			// LEA (LEAU indexed)
+	unprefixed[0x30] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::LEAX>;	// LEA (LEAX indexed)
+	unprefixed[0x31] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::LEAY>;	// LEA (LEAY indexed)
+	unprefixed[0x32] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::LEAS>;	// LEA (LEAS indexed)
+	unprefixed[0x33] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::LEAU>;	// LEA (LEAU indexed)
 
 	// LSR
-	case 0x04: directByte(); LSR(); break;				// LSR (direct)
-	case 0x44: swallowCurrent(); LSRA(); break;			// LSR (LSRA inherent)
-	case 0x54: swallowCurrent(); LSRB(); break;			// LSR (LSRB inherent)
-	case 0x64: indexedByte(); LSR(); break;				// LSR (indexed)
-	case 0x74: extendedByte(); LSR(); break;			// LSR (extended)
+	unprefixed[0x04] = &mc6809::instruction<&mc6809::directByte, &mc6809::LSR>;	// LSR (direct)
+	unprefixed[0x44] = &mc6809::instruction<&mc6809::inherent, &mc6809::LSRA>;	// LSR (LSRA inherent)
+	unprefixed[0x54] = &mc6809::instruction<&mc6809::inherent, &mc6809::LSRB>;	// LSR (LSRB inherent)
+	unprefixed[0x64] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::LSR>;	// LSR (indexed)
+	unprefixed[0x74] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::LSR>;	// LSR (extended)
 
 	// MUL
-	case 0x3d: swallowCurrent(); MUL(); break;			// MUL (inherent)
+	unprefixed[0x3d] = &mc6809::instruction<&mc6809::inherent, &mc6809::MUL>;	// MUL (inherent)
 
 	// NEG
-	case 0x00: directByte(); NEG(); break;				// NEG (direct)
-	case 0x40: swallowCurrent(); NEGA(); break;			// NEG (NEGA, inherent)
-	case 0x50: swallowCurrent(); NEGB(); break;			// NEG (NEGB, inherent)
-	case 0x60: indexedByte(); NEG(); break;				// NEG (indexed)
-	case 0x70: extendedByte(); NEG(); break;			// NEG (extended)
+	unprefixed[0x00] = &mc6809::instruction<&mc6809::directByte, &mc6809::NEG>;	// NEG (direct)
+	unprefixed[0x40] = &mc6809::instruction<&mc6809::inherent, &mc6809::NEGA>;	// NEG (NEGA, inherent)
+	unprefixed[0x50] = &mc6809::instruction<&mc6809::inherent, &mc6809::NEGB>;	// NEG (NEGB, inherent)
+	unprefixed[0x60] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::NEG>;	// NEG (indexed)
+	unprefixed[0x70] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::NEG>;	// NEG (extended)
 
 	// NOP
-	case 0x12: swallowCurrent(); NOP(); break;			// NOP (inherent)
+	unprefixed[0x12] = &mc6809::instruction<&mc6809::inherent>;	// NOP (inherent)
 
 	// OR
 
 	// ORA
-	case 0x8a: immediateByte(); ORA(); break;			// OR (ORA immediate)
-	case 0x9a: directByte(); ORA(); break;				// OR (ORA direct)
-	case 0xaa: indexedByte(); ORA(); break;				// OR (ORA indexed)
-	case 0xba: extendedByte(); ORA(); break;			// OR (ORA extended)
+	unprefixed[0x8a] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ORA>;	// OR (ORA immediate)
+	unprefixed[0x9a] = &mc6809::instruction<&mc6809::directByte, &mc6809::ORA>;	// OR (ORA direct)
+	unprefixed[0xaa] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ORA>;	// OR (ORA indexed)
+	unprefixed[0xba] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ORA>;	// OR (ORA extended)
 
 	// ORB
-	case 0xca: immediateByte(); ORB(); break;			// OR (ORB immediate)
-	case 0xda: directByte(); ORB(); break;				// OR (ORB direct)
-	case 0xea: indexedByte(); ORB(); break;				// OR (ORB indexed)
-	case 0xfa: extendedByte(); ORB(); break;			// OR (ORB extended)
+	unprefixed[0xca] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ORB>;	// OR (ORB immediate)
+	unprefixed[0xda] = &mc6809::instruction<&mc6809::directByte, &mc6809::ORB>;	// OR (ORB direct)
+	unprefixed[0xea] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ORB>;	// OR (ORB indexed)
+	unprefixed[0xfa] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ORB>;	// OR (ORB extended)
 
 	// ORCC
-	case 0x1a: immediateByte(); ORCC(); break;			// OR (ORCC immediate)
+	unprefixed[0x1a] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::ORCC>;	// OR (ORCC immediate)
 
 	// PSH
-	case 0x34: immediateByte(); PSHS(); break;			// PSH (PSHS immediate)
-	case 0x36: immediateByte(); PSHU(); break;			// PSH (PSHU immediate)
+	unprefixed[0x34] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::PSHS>;	// PSH (PSHS immediate)
+	unprefixed[0x36] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::PSHU>;	// PSH (PSHU immediate)
 
 	// PUL
-	case 0x35: immediateByte(); PULS(); break;			// PUL (PULS immediate)
-	case 0x37: immediateByte(); PULU(); break;			// PUL (PULU immediate)
+	unprefixed[0x35] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::PULS>;	// PUL (PULS immediate)
+	unprefixed[0x37] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::PULU>;	// PUL (PULU immediate)
 
 	// ROL
-	case 0x09: directByte(); ROL(); break;				// ROL (direct)
-	case 0x49: swallowCurrent(); ROLA(); break;			// ROL (ROLA inherent)
-	case 0x59: swallowCurrent(); ROLB(); break;			// ROL (ROLB inherent)
-	case 0x69: indexedByte(); ROL(); break;				// ROL (indexed)
-	case 0x79: extendedByte(); ROL(); break;			// ROL (extended)
+	unprefixed[0x09] = &mc6809::instruction<&mc6809::directByte, &mc6809::ROL>;	// ROL (direct)
+	unprefixed[0x49] = &mc6809::instruction<&mc6809::inherent, &mc6809::ROLA>;	// ROL (ROLA inherent)
+	unprefixed[0x59] = &mc6809::instruction<&mc6809::inherent, &mc6809::ROLB>;	// ROL (ROLB inherent)
+	unprefixed[0x69] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ROL>;	// ROL (indexed)
+	unprefixed[0x79] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ROL>;	// ROL (extended)
 
 	// ROR
-	case 0x06: directByte(); ROR(); break;				// ROR (direct)
-	case 0x46: swallowCurrent(); RORA(); break;			// ROR (RORA inherent)
-	case 0x56: swallowCurrent(); RORB(); break;			// ROR (RORB inherent)
-	case 0x66: indexedByte(); ROR(); break;				// ROR (indexed)
-	case 0x76: extendedByte(); ROR(); break;			// ROR (extended)
+	unprefixed[0x06] = &mc6809::instruction<&mc6809::directByte, &mc6809::ROR>;	// ROR (direct)
+	unprefixed[0x46] = &mc6809::instruction<&mc6809::inherent, &mc6809::RORA>;	// ROR (RORA inherent)
+	unprefixed[0x56] = &mc6809::instruction<&mc6809::inherent, &mc6809::RORB>;	// ROR (RORB inherent)
+	unprefixed[0x66] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::ROR>;	// ROR (indexed)
+	unprefixed[0x76] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::ROR>;	// ROR (extended)
 
 	// RTI
-	case 0x3B: swallowCurrent(); RTI(); break;			// RTI (inherent)
+	unprefixed[0x3b] = &mc6809::instruction<&mc6809::inherent, &mc6809::RTI>;	// RTI (inherent)
 
 	// RTS
-	case 0x39: swallowCurrent(); RTS(); break;			// RTS (inherent)
+	unprefixed[0x39] = &mc6809::instruction<&mc6809::inherent, &mc6809::RTS>;	// RTS (inherent)
 
 	// SBC
 
 	// SBCA
-	case 0x82: immediateByte(); SBCA(); break;			// SBC (SBCA immediate)
-	case 0x92: directByte(); SBCA(); break;				// SBC (SBCA direct)
-	case 0xa2: indexedByte(); SBCA(); break;			// SBC (SBCA indexed)
-	case 0xb2: extendedByte(); SBCA(); break;			// SBC (SBCB extended)
+	unprefixed[0x82] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::SBCA>;	// SBC (SBCA immediate)
+	unprefixed[0x92] = &mc6809::instruction<&mc6809::directByte, &mc6809::SBCA>;	// SBC (SBCA direct)
+	unprefixed[0xa2] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::SBCA>;	// SBC (SBCA indexed)
+	unprefixed[0xb2] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::SBCA>;	// SBC (SBCB extended)
 
 	// SBCB
-	case 0xc2: immediateByte(); SBCB(); break;			// SBC (SBCB immediate)
-	case 0xd2: directByte(); SBCB(); break;				// SBC (SBCB direct)
-	case 0xe2: indexedByte(); SBCB(); break;			// SBC (SBCB indexed)
-	case 0xf2: extendedByte(); SBCB(); break;			// SBC (SBCB extended)
+	unprefixed[0xc2] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::SBCB>;	// SBC (SBCB immediate)
+	unprefixed[0xd2] = &mc6809::instruction<&mc6809::directByte, &mc6809::SBCB>;	// SBC (SBCB direct)
+	unprefixed[0xe2] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::SBCB>;	// SBC (SBCB indexed)
+	unprefixed[0xf2] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::SBCB>;	// SBC (SBCB extended)
 
 	// SEX
-	case 0x1d: swallowCurrent(); SEX(); break;			// SEX (inherent)
+	unprefixed[0x1d] = &mc6809::instruction<&mc6809::inherent, &mc6809::SEX>;	// SEX (inherent)
 
 	// ST
 
 	// STA
-	case 0x97: directAddress(); STA(); break;			// ST (STA direct)
-	case 0xa7: indexedAddress(); STA(); break;			// ST (STA indexed)
-	case 0xb7: extendedAddress(); STA(); break;			// ST (STA extended)
+	unprefixed[0x97] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STA>;	// ST (STA direct)
+	unprefixed[0xa7] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STA>;	// ST (STA indexed)
+	unprefixed[0xb7] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STA>;	// ST (STA extended)
 
 	// STB
-	case 0xd7: directAddress(); STB(); break;			// ST (STB direct)
-	case 0xe7: indexedAddress(); STB(); break;			// ST (STB indexed)
-	case 0xf7: extendedAddress(); STB(); break;			// ST (STB extended)
+	unprefixed[0xd7] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STB>;	// ST (STB direct)
+	unprefixed[0xe7] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STB>;	// ST (STB indexed)
+	unprefixed[0xf7] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STB>;	// ST (STB extended)
 
 	// STD
-	case 0xdd: directAddress(); STD(); break;			// ST (STD direct)
-	case 0xed: indexedAddress(); STD(); break;			// ST (STD indexed)
-	case 0xfd: extendedAddress(); STD(); break;			// ST (STD extended)
+	unprefixed[0xdd] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STD>;	// ST (STD direct)
+	unprefixed[0xed] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STD>;	// ST (STD indexed)
+	unprefixed[0xfd] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STD>;	// ST (STD extended)
 
 	// STU
-	case 0xdf: directAddress(); STU(); break;			// ST (STU direct)
-	case 0xef: indexedAddress(); STU(); break;			// ST (STU indexed)
-	case 0xff: extendedAddress(); STU(); break;			// ST (STU extended)
+	unprefixed[0xdf] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STU>;	// ST (STU direct)
+	unprefixed[0xef] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STU>;	// ST (STU indexed)
+	unprefixed[0xff] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STU>;	// ST (STU extended)
 
 	// STX
-	case 0x9f: directAddress(); STX(); break;			// ST (STX direct)
-	case 0xaf: indexedAddress(); STX(); break;			// ST (STX indexed)
-	case 0xbf: extendedAddress(); STX(); break;			// ST (STX extended)
+	unprefixed[0x9f] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STX>;	// ST (STX direct)
+	unprefixed[0xaf] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STX>;	// ST (STX indexed)
+	unprefixed[0xbf] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STX>;	// ST (STX extended)
 
 	// SUB
 
 	// SUBA
-	case 0x80: immediateByte(); SUBA(); break;			// SUB (SUBA immediate)
-	case 0x90: directByte(); SUBA(); break;				// SUB (SUBA direct)
-	case 0xa0: indexedByte(); SUBA(); break;			// SUB (SUBA indexed)
-	case 0xb0: extendedByte(); SUBA(); break;			// SUB (SUBA extended)
+	unprefixed[0x80] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::SUBA>;	// SUB (SUBA immediate)
+	unprefixed[0x90] = &mc6809::instruction<&mc6809::directByte, &mc6809::SUBA>;	// SUB (SUBA direct)
+	unprefixed[0xa0] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::SUBA>;	// SUB (SUBA indexed)
+	unprefixed[0xb0] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::SUBA>;	// SUB (SUBA extended)
 
 	// SUBB
-	case 0xc0: immediateByte(); SUBB(); break;			// SUB (SUBB immediate)
-	case 0xd0: directByte(); SUBB(); break;				// SUB (SUBB direct)
-	case 0xe0: indexedByte(); SUBB(); break;			// SUB (SUBB indexed)
-	case 0xf0: extendedByte(); SUBB(); break;			// SUB (SUBB extended)
+	unprefixed[0xc0] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::SUBB>;	// SUB (SUBB immediate)
+	unprefixed[0xd0] = &mc6809::instruction<&mc6809::directByte, &mc6809::SUBB>;	// SUB (SUBB direct)
+	unprefixed[0xe0] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::SUBB>;	// SUB (SUBB indexed)
+	unprefixed[0xf0] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::SUBB>;	// SUB (SUBB extended)
 
 	// SUBD
-	case 0x83: immediateShort(); SUBD(); break;			// SUB (SUBD immediate)
-	case 0x93: directShort(); SUBD(); break;			// SUB (SUBD direct)
-	case 0xa3: indexedShort(); SUBD(); break;			// SUB (SUBD indexed)
-	case 0xb3: extendedShort(); SUBD(); break;			// SUB (SUBD extended)
+	unprefixed[0x83] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::SUBD>;	// SUB (SUBD immediate)
+	unprefixed[0x93] = &mc6809::instruction<&mc6809::directShort, &mc6809::SUBD>;	// SUB (SUBD direct)
+	unprefixed[0xa3] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::SUBD>;	// SUB (SUBD indexed)
+	unprefixed[0xb3] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::SUBD>;	// SUB (SUBD extended)
 
 	// SWI
-	case 0x3f: swallowCurrent(); SWI(); break;			// SWI (inherent)
+	unprefixed[0x3f] = &mc6809::instruction<&mc6809::inherent, &mc6809::SWI>;	// SWI (inherent)
 
 	// SYNC
-	case 0x13: swallowCurrent(); SYNC(); break;			// SYNC (inherent)
+	unprefixed[0x13] = &mc6809::instruction<&mc6809::inherent, &mc6809::SYNC>;	// SYNC (inherent)
 
 	// TFR
-	case 0x1f: immediateByte(); TFR(); break;			// TFR (immediate)
+	unprefixed[0x1f] = &mc6809::instruction<&mc6809::immediateByte, &mc6809::TFR>;	// TFR (immediate)
 
 	// TST
-	case 0x0d: directByte(); TST(); break;				// TST (direct)
-	case 0x4d: swallowCurrent(); TSTA(); break;			// TST (TSTA inherent)
-	case 0x5d: swallowCurrent(); TSTB(); break;			// TST (TSTB inherent)
-	case 0x6d: indexedByte(); TST(); break;				// TST (indexed)
-	case 0x7d: extendedByte(); TST(); break;			// TST (extended)
+	unprefixed[0x0d] = &mc6809::instruction<&mc6809::directByte, &mc6809::TST>;	// TST (direct)
+	unprefixed[0x4d] = &mc6809::instruction<&mc6809::inherent, &mc6809::TSTA>;	// TST (TSTA inherent)
+	unprefixed[0x5d] = &mc6809::instruction<&mc6809::inherent, &mc6809::TSTB>;	// TST (TSTB inherent)
+	unprefixed[0x6d] = &mc6809::instruction<&mc6809::indexedByte, &mc6809::TST>;	// TST (indexed)
+	unprefixed[0x7d] = &mc6809::instruction<&mc6809::extendedByte, &mc6809::TST>;	// TST (extended)
 
 	// Branching
-	case 0x16: relativeWordAddress(); LBRA(); break;	// BRA (LBRA relative)
-	case 0x17: relativeWordAddress(); LBSR(); break;	// BSR (LBSR relative)
-	case 0x20: relativeByteAddress(); BRA(); break;		// BRA (relative)
-	case 0x21: relativeByteAddress(); BRN(); break;		// BRN (relative)
-	case 0x22: relativeByteAddress(); BHI(); break;		// BHI (relative)
-	case 0x23: relativeByteAddress(); BLS(); break;		// BLS (relative)
-	case 0x24: relativeByteAddress(); BCC(); break;		// BCC (relative)
-	case 0x25: relativeByteAddress(); BCS(); break;		// BCS (relative)
-	case 0x26: relativeByteAddress(); BNE(); break;		// BNE (relative)
-	case 0x27: relativeByteAddress(); BEQ(); break;		// BEQ (relative)
-	case 0x28: relativeByteAddress(); BVC(); break;		// BVC (relative)
-	case 0x29: relativeByteAddress(); BVS(); break;		// BVS (relative)
-	case 0x2a: relativeByteAddress(); BPL(); break;		// BPL (relative)
-	case 0x2b: relativeByteAddress(); BMI(); break;		// BMI (relative)
-	case 0x2c: relativeByteAddress(); BGE(); break;		// BGE (relative)
-	case 0x2d: relativeByteAddress(); BLT(); break;		// BLT (relative)
-	case 0x2e: relativeByteAddress(); BGT(); break;		// BGT (relative)
-	case 0x2f: relativeByteAddress(); BLE(); break;		// BLE (relative)
-
-	case 0x8d: relativeByteAddress(); BSR(); break;		// BSR (relative)
-
-	default:
-		UNREACHABLE;
-	}
-}
-
-void EightBit::mc6809::execute10() {
-
-	switch (opcode()) {
+	unprefixed[0x16] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBRA>;	// BRA (LBRA relative)
+	unprefixed[0x17] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBSR>;	// BSR (LBSR relative)
+	unprefixed[0x20] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BRA>;	// BRA (relative)
+	unprefixed[0x21] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BRN>;	// BRN (relative)
+	unprefixed[0x22] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BHI>;	// BHI (relative)
+	unprefixed[0x23] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BLS>;	// BLS (relative)
+	unprefixed[0x24] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BCC>;	// BCC (relative)
+	unprefixed[0x25] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BCS>;	// BCS (relative)
+	unprefixed[0x26] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BNE>;	// BNE (relative)
+	unprefixed[0x27] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BEQ>;	// BEQ (relative)
+	unprefixed[0x28] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BVC>;	// BVC (relative)
+	unprefixed[0x29] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BVS>;	// BVS (relative)
+	unprefixed[0x2a] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BPL>;	// BPL (relative)
+	unprefixed[0x2b] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BMI>;	// BMI (relative)
+	unprefixed[0x2c] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BGE>;	// BGE (relative)
+	unprefixed[0x2d] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BLT>;	// BLT (relative)
+	unprefixed[0x2e] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BGT>;	// BGT (relative)
+	unprefixed[0x2f] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BLE>;	// BLE (relative)
+
+	unprefixed[0x8d] = &mc6809::instruction<&mc6809::relativeByteAddress, &mc6809::BSR>;	// BSR (relative)
+
+	// Page 2 (prefixed by 0x10)
 
 	// CMP
 
 	// CMPD
-	case 0x83: immediateShort(); CMPD(); break;			// CMP (CMPD, immediate)
-	case 0x93: directShort(); CMPD(); break;			// CMP (CMPD, direct)
-	case 0xa3: indexedShort(); CMPD(); break;			// CMP (CMPD, indexed)
-	case 0xb3: extendedShort(); CMPD(); break;			// CMP (CMPD, extended)
+	page10[0x83] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::CMPD>;	// CMP (CMPD, immediate)
+	page10[0x93] = &mc6809::instruction<&mc6809::directShort, &mc6809::CMPD>;	// CMP (CMPD, direct)
+	page10[0xa3] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::CMPD>;	// CMP (CMPD, indexed)
+	page10[0xb3] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::CMPD>;	// CMP (CMPD, extended)
 
 	// CMPY
-	case 0x8c: immediateShort(); CMPY(); break;			// CMP (CMPY, immediate)
-	case 0x9c: directShort(); CMPY(); break;			// CMP (CMPY, direct)
-	case 0xac: indexedShort(); CMPY(); break;			// CMP (CMPY, indexed)
-	case 0xbc: extendedShort(); CMPY(); break;			// CMP (CMPY, extended)
+	page10[0x8c] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::CMPY>;	// CMP (CMPY, immediate)
+	page10[0x9c] = &mc6809::instruction<&mc6809::directShort, &mc6809::CMPY>;	// CMP (CMPY, direct)
+	page10[0xac] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::CMPY>;	// CMP (CMPY, indexed)
+	page10[0xbc] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::CMPY>;	// CMP (CMPY, extended)
 
 	// LD
 
 	// LDS
-	case 0xce: immediateShort(); LDS(); break;			// LD (LDS immediate)
-	case 0xde: directShort(); LDS(); break;				// LD (LDS direct)
-	case 0xee: indexedShort(); LDS(); break;			// LD (LDS indexed)
-	case 0xfe: extendedShort(); LDS(); break;			// LD (LDS extended)
+	page10[0xce] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::LDS>;	// LD (LDS immediate)
+	page10[0xde] = &mc6809::instruction<&mc6809::directShort, &mc6809::LDS>;	// LD (LDS direct)
+	page10[0xee] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::LDS>;	// LD (LDS indexed)
+	page10[0xfe] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::LDS>;	// LD (LDS extended)
 
 	// LDY
-	case 0x8e: immediateShort(); LDY(); break;			// LD (LDY immediate)
-	case 0x9e: directShort(); LDY(); break;				// LD (LDY direct)
-	case 0xae: indexedShort(); LDY(); break;			// LD (LDY indexed)
-	case 0xbe: extendedShort(); LDY(); break;			// LD (LDY extended)
+	page10[0x8e] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::LDY>;	// LD (LDY immediate)
+	page10[0x9e] = &mc6809::instruction<&mc6809::directShort, &mc6809::LDY>;	// LD (LDY direct)
+	page10[0xae] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::LDY>;	// LD (LDY indexed)
+	page10[0xbe] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::LDY>;	// LD (LDY extended)
 
 	// Branching
-	case 0x21: relativeWordAddress(); LBRN(); break;	// BRN (LBRN relative)
-	case 0x22: relativeWordAddress(); LBHI(); break;	// BHI (LBHI relative)
-	case 0x23: relativeWordAddress(); LBLS(); break;	// BLS (LBLS relative)
-	case 0x24: relativeWordAddress(); LBCC(); break;	// BCC (LBCC relative)
-	case 0x25: relativeWordAddress(); LBCS(); break;	// BCS (LBCS relative)
-	case 0x26: relativeWordAddress(); LBNE(); break;	// BNE (LBNE relative)
-	case 0x27: relativeWordAddress(); LBEQ(); break;	// BEQ (LBEQ relative)
-	case 0x28: relativeWordAddress(); LBVC(); break;	// BVC (LBVC relative)
-	case 0x29: relativeWordAddress(); LBVS(); break;	// BVS (LBVS relative)
-	case 0x2a: relativeWordAddress(); LBPL(); break;	// BPL (LBPL relative)
-	case 0x2b: relativeWordAddress(); LBMI(); break;	// BMI (LBMI relative)
-	case 0x2c: relativeWordAddress(); LBGE(); break;	// BGE (LBGE relative)
-	case 0x2d: relativeWordAddress(); LBLT(); break;	// BLT (LBLT relative)
-	case 0x2e: relativeWordAddress(); LBGT(); break;	// BGT (LBGT relative)
-	case 0x2f: relativeWordAddress(); LBLE(); break;	// BLE (LBLE relative)
+	page10[0x21] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBRN>;	// BRN (LBRN relative)
+	page10[0x22] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBHI>;	// BHI (LBHI relative)
+	page10[0x23] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBLS>;	// BLS (LBLS relative)
+	page10[0x24] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBCC>;	// BCC (LBCC relative)
+	page10[0x25] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBCS>;	// BCS (LBCS relative)
+	page10[0x26] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBNE>;	// BNE (LBNE relative)
+	page10[0x27] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBEQ>;	// BEQ (LBEQ relative)
+	page10[0x28] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBVC>;	// BVC (LBVC relative)
+	page10[0x29] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBVS>;	// BVS (LBVS relative)
+	page10[0x2a] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBPL>;	// BPL (LBPL relative)
+	page10[0x2b] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBMI>;	// BMI (LBMI relative)
+	page10[0x2c] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBGE>;	// BGE (LBGE relative)
+	page10[0x2d] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBLT>;	// BLT (LBLT relative)
+	page10[0x2e] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBGT>;	// BGT (LBGT relative)
+	page10[0x2f] = &mc6809::instruction<&mc6809::relativeWordAddress, &mc6809::LBLE>;	// BLE (LBLE relative)
 
 	// STS
-	case 0xdf: directAddress(); STS(); break;			// ST (STS direct)
-	case 0xef: indexedAddress(); STS(); break;			// ST (STS indexed)
-	case 0xff: extendedAddress(); STS(); break;			// ST (STS extended)
+	page10[0xdf] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STS>;	// ST (STS direct)
+	page10[0xef] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STS>;	// ST (STS indexed)
+	page10[0xff] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STS>;	// ST (STS extended)
 
 	// STY
-	case 0x9f: directAddress(); STY(); break;			// ST (STY direct)
-	case 0xaf: indexedAddress(); STY(); break;			// ST (STY indexed)
-	case 0xbf: extendedAddress(); STY(); break;			// ST (STY extended)
+	page10[0x9f] = &mc6809::instruction<&mc6809::directAddress, &mc6809::STY>;	// ST (STY direct)
+	page10[0xaf] = &mc6809::instruction<&mc6809::indexedAddress, &mc6809::STY>;	// ST (STY indexed)
+	page10[0xbf] = &mc6809::instruction<&mc6809::extendedAddress, &mc6809::STY>;	// ST (STY extended)
 
 	// SWI
-	case 0x3f: swallowCurrent(); SWI2(); break;			// SWI (SWI2 inherent)
+	page10[0x3f] = &mc6809::instruction<&mc6809::inherent, &mc6809::SWI2>;	// SWI (SWI2 inherent)
 
-	default:
-		UNREACHABLE;
-	}
-}
-
-void EightBit::mc6809::execute11() {
-
-	switch (opcode()) {
+	// Page 3 (prefixed by 0x11)
 
 	// CMP
 
 	// CMPU
-	case 0x83: immediateShort(); CMPU(); break;			// CMP (CMPU, immediate)
-	case 0x93: directShort(); CMPU(); break;			// CMP (CMPU, direct)
-	case 0xa3: indexedShort(); CMPU(); break;			// CMP (CMPU, indexed)
-	case 0xb3: extendedShort(); CMPU(); break;			// CMP (CMPU, extended)
+	page11[0x83] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::CMPU>;	// CMP (CMPU, immediate)
+	page11[0x93] = &mc6809::instruction<&mc6809::directShort, &mc6809::CMPU>;	// CMP (CMPU, direct)
+	page11[0xa3] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::CMPU>;	// CMP (CMPU, indexed)
+	page11[0xb3] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::CMPU>;	// CMP (CMPU, extended)
 
 	// CMPS
-	case 0x8c: immediateShort(); CMPS(); break;			// CMP (CMPS, immediate)
-	case 0x9c: directShort(); CMPS(); break;			// CMP (CMPS, direct)
-	case 0xac: indexedShort(); CMPS(); break;			// CMP (CMPS, indexed)
-	case 0xbc: extendedShort(); CMPS(); break;			// CMP (CMPS, extended)
+	page11[0x8c] = &mc6809::instruction<&mc6809::immediateShort, &mc6809::CMPS>;	// CMP (CMPS, immediate)
+	page11[0x9c] = &mc6809::instruction<&mc6809::directShort, &mc6809::CMPS>;	// CMP (CMPS, direct)
+	page11[0xac] = &mc6809::instruction<&mc6809::indexedShort, &mc6809::CMPS>;	// CMP (CMPS, indexed)
+	page11[0xbc] = &mc6809::instruction<&mc6809::extendedShort, &mc6809::CMPS>;	// CMP (CMPS, extended)
 
 	// SWI
-	case 0x3f: swallowCurrent(); SWI3(); break;			// SWI (SWI3 inherent)
+	page11[0x3f] = &mc6809::instruction<&mc6809::inherent, &mc6809::SWI3>;	// SWI (SWI3 inherent)
 
-	default:
-		UNREACHABLE;
-	}
-}
+	return pages;
+}();
 
 #pragma region Miscellaneous instruction implementations
 
 void EightBit::mc6809::prefix10() {
-	m_prefix10 = true;
+	m_page = 1;
 	base::execute(fetchInstruction());
 }
 
 void EightBit::mc6809::prefix11() {
-	m_prefix11 = true;
+	m_page = 2;
 	base::execute(fetchInstruction());
 }
 
@@ -712,94 +702,56 @@ EightBit::register16_t& EightBit::mc6809::RR(int which) {
 
 void EightBit::mc6809::indexedAddress() {
 	fetchByte();
-	const auto type = BUS().DATA();
-	auto& r = RR((type & (Bit6 | Bit5)) >> 5);
-	if ((type & Bit7) != 0) {
-		switch (type & Mask4) {
-		case 0b0000: // ,R+
-			EA() = r;
-			++r;
-			swallowCurrent();
-			swallowRead(2);
-			break;
-		case 0b0001: // ,R++
-			EA() = r;
-			r += 2;
-			swallowCurrent();
-			swallowRead(3);
-			break;
-		case 0b0010: // ,-R
-			--r;
-			EA() = r;
-			swallowCurrent();
-			swallowRead(2);
-			break;
-		case 0b0011: // ,--R
-			r -= 2;
-			EA() = r;
-			swallowCurrent();
-			swallowRead(3);
-			break;
-		case 0b0100: // ,R
-			EA() = r;
-			swallowCurrent();
-			break;
-		case 0b0101: // B,R
-			EA().joined = r.joined + B();
-			swallowCurrent();
-			swallowRead();
-			break;
-		case 0b0110: // A,R
-			EA().joined = r.joined + (int8_t)A();
-			swallowCurrent();
-			swallowRead();
-			break;
-		case 0b1000: // n,R (eight-bit)
-			fetchByte();
-			EA().joined = r.joined + (int8_t)BUS().DATA();
-			swallowRead();
-			break;
-		case 0b1001: // n,R (sixteen-bit)
-			fetchInto(intermediate());
-			EA() = intermediate();
-			EA().joined += r.joined;
-			swallowCurrent();
-			swallowRead(2);
-			break;
-		case 0b1011: // D,R
-			EA().joined = r.joined + D().joined;
-			swallowCurrent(3);
-			swallowRead(2);
-			break;
-		case 0b1100: // n,PCR (eight-bit)
-			relativeByteAddress();
-			swallowRead();
-			break;
-		case 0b1101: // n,PCR (sixteen-bit)
-			relativeWordAddress();
-			swallowCurrent();
-			swallowRead(3);
-			break;
-		case 0b1111: // [n]
-			fetchInto(intermediate());
-			EA() = intermediate();
-			swallowCurrent();
-			break;
-		default:
-			assert(false && "Invalid index type");
-		}
-
-		const auto indirect = type & Bit4;
-		if (indirect != 0) {
-			LEA(BUS().ADDRESS());
-			getInto(EA());
-			swallowRead();
-		}
+	const auto& mode = indexMode(BUS().DATA());
+	auto& r = RR(mode.reg);
+	if (mode.adjust < 0)
+		r.joined += mode.adjust;
+	switch (mode.offset) {
+	case index_t::Register:
+		EA() = r;
+		break;
+	case index_t::Offset5:
+		EA().joined = r.joined + mode.displacement;
+		break;
+	case index_t::B:
+		EA().joined = r.joined + B();
+		break;
+	case index_t::A:
+		EA().joined = r.joined + (int8_t)A();
+		break;
+	case index_t::D:
+		EA().joined = r.joined + D().joined;
+		break;
+	case index_t::Offset8:
+		fetchByte();
+		EA().joined = r.joined + (int8_t)BUS().DATA();
+		break;
+	case index_t::Offset16:
+		fetchInto(intermediate());
+		EA().joined = r.joined + intermediate().joined;
+		break;
+	case index_t::Relative8:
+		relativeByteAddress();
+		break;
+	case index_t::Relative16:
+		relativeWordAddress();
+		break;
+	case index_t::Extended:
+		fetchInto(intermediate());
+		EA() = intermediate();
+		break;
+	default:
+		assert(false && "Invalid index type");
 	}
-	else {
-		// EA = ,R + 5-bit offset
-		EA().joined = r.joined + signExtend(5, type & Mask5);
-		swallowCurrent();
+	if (mode.adjust > 0)
+		r.joined += mode.adjust;
+
+	swallowCurrent(mode.current);
+	swallowRead(mode.idle);
+
+	if (mode.indirect) {
+		LEA(BUS().ADDRESS());
+		getInto(EA());
 		swallowRead();
 	}
 }
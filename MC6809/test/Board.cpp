@@ -52,30 +52,24 @@ void Board::initialise() noexcept {
 		ACIA().markTransmitComplete();
 	});
 
-	// Marshal data from memory -> ACIA
-	CPU().WrittenMemory.connect([this] (EightBit::EventArgs&) {
-		updateAciaPins();
-		if (ACIA().selected())
-			accessAcia();
-	});
-
-	// Marshal data from ACIA -> memory
-	CPU().ReadingMemory.connect([this] (EightBit::EventArgs&) {
-		updateAciaPins();
-		if (accessAcia())
-			poke(ACIA().DATA());
-	});
+	// The serial interface, minimally decoded at A000 - BFFF
+	attach(0xa000, 0xbfff,
+		[this] (EightBit::EventArgs&) {	// Marshal data from ACIA -> memory
+			updateAciaPins();
+			if (accessAcia())
+				poke(ACIA().DATA());
+		},
+		[this] (EightBit::EventArgs&) {	// Marshal data from memory -> ACIA
+			updateAciaPins();
+			if (ACIA().selected())
+				accessAcia();
+		});
 
 	// Keyboard wiring, check for input once per frame
-	CPU().ExecutedInstruction.connect([this] (EightBit::EventArgs&) {
-		assert(CPU().cycles() > 0);
-		m_frameCycleCount -= CPU().cycles();
-		if (m_frameCycleCount < 0) {
-			if (_kbhit()) {
-				ACIA().RDR() = _getch();
-				ACIA().markReceiveStarting();
-			}
-			m_frameCycleCount = Configuration::FrameCycleInterval;
+	scheduler().every(Configuration::FrameCycleInterval, [this] (EightBit::EventArgs&) {
+		if (_kbhit()) {
+			ACIA().RDR() = _getch();
+			ACIA().markReceiveStarting();
 		}
 	});
 
@@ -102,16 +96,15 @@ void Board::initialise() noexcept {
 
 	if (m_configuration.terminatesEarly()) {
 		// Early termination condition for CPU timing code
-		CPU().ExecutedInstruction.connect([this] (EightBit::EventArgs&) {
-			assert(CPU().cycles() > 0);
-			m_totalCycleCount += CPU().cycles();
-			if (m_totalCycleCount > Configuration::TerminationCycles)
-				lowerPOWER();
+		scheduler().at(Configuration::TerminationCycles, [this] (EightBit::EventArgs&) {
+			lowerPOWER();
 		});
 	}
+
+	remap();
 }
 
-const EightBit::MemoryMapping& Board::mapping(uint16_t address) noexcept {
+EightBit::MemoryMapping Board::mapping(uint16_t address) noexcept {
 
 	if (address < 0x8000)
 		return m_ramMapping;
@@ -26,7 +26,7 @@ public:
 	virtual void initialise() noexcept final;
 
 protected:
-	const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final;
+	EightBit::MemoryMapping mapping(uint16_t address) noexcept final;
 
 private:
 	const Configuration& m_configuration;
@@ -46,9 +46,6 @@ private:
 	EightBit::Disassembly m_disassembler = { *this, m_cpu };
 	EightBit::Profiler m_profiler = { m_cpu, m_disassembler };
 
-	uint64_t m_totalCycleCount = 0UL;
-	int64_t m_frameCycleCount = 0L;
-
 	// The m_disassembleAt and m_ignoreDisassembly are used to skip pin events
 	EightBit::register16_t m_disassembleAt = 0x0000;
 	bool m_ignoreDisassembly = false;
@@ -15,6 +15,8 @@ int main(int argc, char* argv[]) {
 #endif
 
 	auto harness = std::make_shared<EightBit::TestHarness<Configuration, Board>>(configuration);
+	if (!harness->parse(argc, argv))
+		return 1;
 	harness->run();
 
 	return 0;
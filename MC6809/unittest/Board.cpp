@@ -32,6 +32,6 @@ void Board::initialise() noexcept {
 	});
 }
 
-const EightBit::MemoryMapping& Board::mapping(uint16_t) noexcept {
+EightBit::MemoryMapping Board::mapping(uint16_t) noexcept {
 	return m_mapping;
 }
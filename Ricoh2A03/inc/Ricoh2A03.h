@@ -5,13 +5,13 @@
 #include <Bus.h>
 
 namespace EightBit {
+	// The NES CPU: an NMOS 6502 without decimal arithmetic
 	class Ricoh2A03 final : public MOS6502 {
 	public:
-		Ricoh2A03(Bus& bus);
+		Ricoh2A03(Bus& bus, mode_t mode = mode_t::Exact) noexcept;
 		virtual ~Ricoh2A03() = default;
 
-	protected:
-		uint8_t sub(uint8_t operand, int borrow) final;
-		void adc() final;
+	private:
+		void dispatchVariant() noexcept final;
 	};
 }
\ No newline at end of file
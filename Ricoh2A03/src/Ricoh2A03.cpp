@@ -1,14 +1,10 @@
 #include "stdafx.h"
 #include "../inc/Ricoh2A03.h"
 
-EightBit::Ricoh2A03::Ricoh2A03(Bus& bus)
-: MOS6502(bus) {
+EightBit::Ricoh2A03::Ricoh2A03(Bus& bus, const mode_t mode) noexcept
+: MOS6502(bus, mode) {
 }
 
-uint8_t EightBit::Ricoh2A03::sub(uint8_t operand, int borrow) {
-	return MOS6502::sub_b(operand, borrow);
-}
-
-void EightBit::Ricoh2A03::adc() {
-	MOS6502::adc_b();
+void EightBit::Ricoh2A03::dispatchVariant() noexcept {
+	dispatch<Ricoh>();
 }
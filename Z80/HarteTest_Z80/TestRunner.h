@@ -12,7 +12,7 @@ private:
 	EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
 
 protected:
-	const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final { return m_mapping; }
+	EightBit::MemoryMapping mapping(uint16_t address) noexcept final { return m_mapping; }
 
 public:
     TestRunner();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -10,7 +11,10 @@ private:
     // N.B.
     // The parser must be kept for the lifetime of any parsed data.
     // Therefore, it can only be used for one document at a time.
-    static simdjson::dom::parser m_parser;
+    // Each suite has its own (on the heap, so that parsed data
+    // survives the suite being moved), so suites may be loaded
+    // on different threads.
+    std::unique_ptr<simdjson::dom::parser> m_parser = std::make_unique<simdjson::dom::parser>();
 
     std::string m_path;
     simdjson::dom::element m_raw;
@@ -63,7 +63,7 @@ void Fuse::TestRunner::lowerPOWER() {
 	EightBit::Bus::lowerPOWER();
 }
 
-EightBit::MemoryMapping Fuse::TestRunner::mapping(uint16_t address) {
+EightBit::MemoryMapping Fuse::TestRunner::mapping(uint16_t address) noexcept {
 	return {
 		m_ram,
 		0x0000,
@@ -42,7 +42,7 @@ namespace Fuse {
 		void dumpActualEvents() const;
 
 	protected:
-		virtual EightBit::MemoryMapping mapping(uint16_t address) final;
+		virtual EightBit::MemoryMapping mapping(uint16_t address) noexcept final;
 
 	public:
 		TestRunner(const Test& test, const ExpectedTestResult& expected);
@@ -4,6 +4,9 @@
 #include <cstdint>
 #include <array>
 #include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <IntelProcessor.h>
 #include <InputOutput.h>
@@ -52,6 +55,11 @@ namespace EightBit {
 				++variable;
 				return *this;
 			}
+
+			constexpr auto& operator+=(const int increment) noexcept {
+				variable += increment;
+				return *this;
+			}
 		};
 
 		enum StatusBits {
@@ -66,7 +74,11 @@ namespace EightBit {
 			CF = Bit0,
 		};
 
-		Z80(Bus& bus, InputOutput& ports) noexcept;
+		// Fast mode keeps instruction timing and the refresh register exact, but
+		// leaves the bus control pins alone whenever nothing is watching them.
+		enum class mode_t { Exact, Fast };
+
+		Z80(Bus& bus, InputOutput& ports, mode_t mode = mode_t::Exact) noexcept;
 
 		Z80(const Z80& rhs) noexcept;
 		bool operator==(const Z80& rhs) const noexcept;
@@ -107,6 +119,21 @@ namespace EightBit {
 
 		[[nodiscard]] constexpr auto& Q() noexcept { return m_q; }
 
+		[[nodiscard]] constexpr auto& mode() noexcept { return m_mode; }
+
+		// An optional cache of decoded instructions, keyed by address.  Cached instructions
+		// skip the fetch and decode of their opcodes and operands and, while nothing is
+		// watching instructions, a single step threads through them up to the next change
+		// of flow.  It is only used in fast mode.  Pages holding cached
+		// instructions are watched on the bus, so writing to them invalidates the cache.
+		// Memory changed around the bus (with "poke", say), or remapped to be visible
+		// through more than one page, needs a "flush".
+		void cache(bool enabled) noexcept;
+		[[nodiscard]] constexpr auto caching() const noexcept { return m_caching; }
+		void flush() noexcept;
+
+		[[nodiscard]] size_t footprint() const noexcept;
+
 		constexpr void exx() noexcept { m_registerSet ^= 1; }
 		constexpr void exxAF() noexcept { m_accumulatorFlagsSet ^= 1; }
 
@@ -122,6 +149,9 @@ namespace EightBit {
 		void handleRESET() noexcept final;
 		void handleINT() noexcept final;
 
+		[[nodiscard]] bool spinning() noexcept final;
+		void spin(uint64_t iterations) noexcept final;
+
 		void memoryUpdate(int ticks = 1) noexcept;
 		void memoryWrite() noexcept final;
 		void memoryRead() noexcept final;
@@ -137,6 +167,9 @@ namespace EightBit {
 		bool m_resetPending = false;
 
 		InputOutput& m_ports;
+
+		mode_t m_mode = mode_t::Exact;
+		bool m_quiet = false;		// Fast, and nothing is watching the pins, for the current instruction
 			
 		enum { BC_IDX, DE_IDX, HL_IDX };
 
@@ -159,25 +192,83 @@ namespace EightBit {
 		uint8_t m_q = 0;				// Previously modified instruction status register
 		uint8_t m_modifiedF = 0;        // In-flight status register.  Used to build "Q"
 
-		bool m_prefixCB = false;
-		bool m_prefixDD = false;
-		bool m_prefixED = false;
-		bool m_prefixFD = false;
+		// The instruction page selected by any prefixes.  The DD and FD pages
+		// are the unprefixed instructions, with IX or IY in place of HL, and
+		// DDCB/FDCB are the displaced forms of the CB page.
+		enum page_t { Unprefixed, CB, ED, DD, FD, DDCB, FDCB, Pages };
+		page_t m_page = Unprefixed;
 
 		int8_t m_displacement = 0;
 
+		// One handler for each opcode on each page, generated at compile time
+		typedef void (*handler_t)(Z80&) noexcept;
+		typedef std::array<handler_t, 0x100> handlers_t;
+		static const std::array<handlers_t, Pages> m_handlers;
+
+		template<page_t Page, size_t... Opcodes>
+		[[nodiscard]] static constexpr handlers_t handlers(std::index_sequence<Opcodes...>) noexcept;
+
+		template<page_t Page, uint8_t Opcode>
+		static void dispatch(Z80& cpu) noexcept;
+
+		template<page_t Page, uint8_t Opcode>
+		[[nodiscard]] static constexpr handler_t handler() noexcept;
+
+		[[nodiscard]] static constexpr bool displacing(uint8_t opcode) noexcept;
+
+		static constexpr int MaximumLength = 4;		// DD 36 d n, say
+
+		// A decoded instruction: its prefix (if any), opcode and operands have already been fetched
+		struct cached_t {
+			handler_t handler = nullptr;	// Not cacheable, if null
+			uint32_t stamp = 0;				// Valid while it matches the stamp of its page
+			uint8_t opcode = 0;
+			uint8_t page = Unprefixed;
+			uint8_t fetches = 0;
+			uint8_t cycles = 0;				// Taken to fetch all of them
+			bool ends = false;				// Control may not pass to the next instruction
+			std::array<uint8_t, 2> operands = {};	// Including any displacement
+		};
+
+		struct cached_page_t {
+			const uint8_t* storage = nullptr;
+			uint32_t stamp = 1;
+			bool aliased = false;			// Also visible through another page, so never cached
+			std::array<cached_t, 0x100> instructions;
+		};
+
+		bool m_caching = false;
+		bool m_threaded = false;		// More than one instruction was run by the current step
+		const uint8_t* m_operand = nullptr;	// The next operand of the cached instruction being run
+		std::vector<std::unique_ptr<cached_page_t>> m_cache;
+		ScopedConnection m_invalidation;
+
+		[[nodiscard]] const cached_t* cached() noexcept;
+		[[nodiscard]] bool aliased(uint8_t page) noexcept;
+		void decode(const uint8_t* storage, uint8_t offset, cached_t& instruction) noexcept;
+		void invalidate(register16_t address) noexcept;
+		void thread(const cached_t* instruction) noexcept;
+		void run(const cached_t& instruction) noexcept;
+		[[nodiscard]] static constexpr bool ends(page_t page, uint8_t opcode) noexcept;
+		[[nodiscard]] static constexpr int operands(page_t page, uint8_t opcode) noexcept;
+
 		void handleNMI() noexcept;
 
-		[[nodiscard]] constexpr auto displaced() const noexcept { return m_prefixDD || m_prefixFD; }
+		[[nodiscard]] bool observed() noexcept;
+
+		[[nodiscard]] static constexpr auto displaced(const page_t page) noexcept { return page >= DD; }
+		[[nodiscard]] constexpr auto displaced() const noexcept { return displaced(m_page); }
+		[[nodiscard]] constexpr auto indexedByIX() const noexcept { return (m_page == DD) || (m_page == DDCB); }
 
 		[[nodiscard]] constexpr void displaceAddress() noexcept {
 			assert(displaced() && "Address can only be displaced if a prefix is active");
-			const auto& index_register = m_prefixDD ? IX() : IY();
+			const auto& index_register = indexedByIX() ? IX() : IY();
 			BUS().ADDRESS() = MEMPTR() = index_register.joined + m_displacement;
 		}
 
 		void fetchDisplacement() noexcept;
 		[[nodiscard]] uint8_t fetchInstruction() noexcept final;
+		void fetchByte() noexcept final;
 
 		uint8_t readDataUnderInterrupt() noexcept;
 
@@ -233,37 +324,22 @@ namespace EightBit {
 		[[nodiscard]] static constexpr uint8_t adjustZero(uint8_t input, uint8_t value) noexcept { return clearBit(input, ZF, value); }
 
 		void adjustParity(uint8_t value) noexcept { adjustStatusFlags(adjustParity(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustParity(uint8_t input, uint8_t value) noexcept { return setBit(input, PF, evenParity(value)); }
+		[[nodiscard]] static constexpr uint8_t adjustParity(uint8_t input, uint8_t value) noexcept { return base::adjustParity<Z80>(input, value); }
 
 		void adjustSZ(uint8_t value) noexcept { adjustStatusFlags(adjustSZ(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZ(uint8_t input, uint8_t value) noexcept {
-			input = adjustSign(input, value);
-			return adjustZero(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZ(uint8_t input, uint8_t value) noexcept { return base::adjustSZ<Z80>(input, value); }
 
 		void adjustSZP(uint8_t value) noexcept { adjustStatusFlags(adjustSZP(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZP(uint8_t input, uint8_t value) noexcept {
-			input = adjustSZ(input, value);
-			return adjustParity(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZP(uint8_t input, uint8_t value) noexcept { return base::adjustSZP<Z80>(input, value); }
 
 		void adjustXY(uint8_t value) noexcept { adjustStatusFlags(adjustXY(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustXY(uint8_t input, uint8_t value) noexcept {
-			input = setBit(input, XF, xTest(value));
-			return setBit(input, YF, yTest(value));
-		}
+		[[nodiscard]] static constexpr uint8_t adjustXY(uint8_t input, uint8_t value) noexcept { return base::adjustXY<Z80>(input, value); }
 
 		void adjustSZPXY(uint8_t value) noexcept { adjustStatusFlags(adjustSZPXY(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZPXY(uint8_t input, uint8_t value) noexcept {
-			input = adjustSZP(input, value);
-			return adjustXY(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZPXY(uint8_t input, uint8_t value) noexcept { return base::adjustSZPXY<Z80>(input, value); }
 
 		void adjustSZXY(uint8_t value) noexcept { adjustStatusFlags(adjustSZXY(F(), value)); }
-		[[nodiscard]] static constexpr uint8_t adjustSZXY(uint8_t input, uint8_t value) noexcept {
-			input = adjustSZ(input, value);
-			return adjustXY(input, value);
-		}
+		[[nodiscard]] static constexpr uint8_t adjustSZXY(uint8_t input, uint8_t value) noexcept { return base::adjustSZXY<Z80>(input, value); }
 
 		[[nodiscard]] static constexpr auto adjustHalfCarryAdd(uint8_t f, uint8_t before, uint8_t value, int calculation) noexcept {
 			return setBit(f, HC, calculateHalfCarryAdd(before, value, calculation));
@@ -317,9 +393,9 @@ namespace EightBit {
 
 		[[nodiscard]] bool convertCondition(int flag) noexcept final;
 
-		void executeCB(int x, int y, int z) noexcept;
-		void executeED(int x, int y, int z, int p, int q) noexcept;
-		void executeOther(int x, int y, int z, int p, int q) noexcept;
+		template<bool Indexed, uint8_t Opcode> void executeCB() noexcept;
+		template<uint8_t Opcode> void executeED() noexcept;
+		template<bool Indexed, uint8_t Opcode> void executeOther() noexcept;
 
 		[[nodiscard]] uint8_t increment(uint8_t operand) noexcept;
 		[[nodiscard]] uint8_t decrement(uint8_t operand) noexcept;
@@ -362,6 +438,12 @@ namespace EightBit {
 		[[nodiscard]] static constexpr auto set(int n, uint8_t operand) noexcept { return Chip::setBit(operand, Chip::bit(n)); }
 
 		void daa() noexcept;
+
+		// DAA depends upon nothing but A and the carry, subtract and half carry flags,
+		// so every result (flags low, A high) is worked out at compile time.
+		[[nodiscard]] static constexpr auto daaIndex(const uint8_t a, const uint8_t f) noexcept { return a | ((f & (CF | NF)) << 8) | ((f & HC) << 6); }
+		[[nodiscard]] static constexpr register16_t decimalAdjust(uint8_t a, uint8_t f) noexcept;
+		static const std::array<register16_t, 0x800> m_daa;
 		void scf() noexcept;
 		void ccf() noexcept;
 		void cpl() noexcept final;
@@ -386,6 +468,23 @@ namespace EightBit {
 
 		void repeatBlockInstruction() noexcept;
 		void loadRepeat() noexcept;
+
+		// A repeating block instruction may run further iterations within the same step,
+		// skipping the refetch and decode, as long as nothing could tell the difference.
+		// Iterations certain to repeat may be skipped in bulk, straight through host memory.
+		static constexpr int RepeatCycles = 21;
+
+		typedef void (Z80::*iteration_t)() noexcept;
+		typedef size_t (Z80::*skip_t)(size_t limit) noexcept;
+
+		void repeat(iteration_t iteration, skip_t skip = nullptr) noexcept;
+		[[nodiscard]] int repeatable() noexcept;
+		[[nodiscard]] bool refetchable() noexcept;
+		[[nodiscard]] bool overwrites(const uint8_t* begin, size_t count) noexcept;
+		void refetch() noexcept;
+
+		template<int Direction> [[nodiscard]] size_t skipLoads(size_t limit) noexcept;
+		template<int Direction> [[nodiscard]] size_t skipCompares(size_t limit) noexcept;
 		void adjustBlockRepeatFlagsIO() noexcept;
 		void adjustBlockInputOutputFlags(int basis) noexcept;
 		void adjustBlockInFlagsIncrement() noexcept;
@@ -5,22 +5,27 @@
 
 EightBit::Profiler::Profiler(Z80& cpu, Disassembler& disassembler)
 : m_cpu(cpu),
-  m_disassembler(disassembler) {
-	std::fill(m_instructions.begin(), m_instructions.end(), 0);
-	std::fill(m_addresses.begin(), m_addresses.end(), 0);
-}
+  m_disassembler(disassembler) {}
 
 EightBit::Profiler::~Profiler() {
 }
 
 void EightBit::Profiler::addInstruction(uint8_t instruction) {
+	if (m_instructions.empty())
+		m_instructions.resize(0x100);
 	m_instructions[instruction]++;
 }
 
 void EightBit::Profiler::addAddress(uint16_t address) {
+	if (m_addresses.empty())
+		m_addresses.resize(0x10000);
 	m_addresses[address]++;
 }
 
+size_t EightBit::Profiler::footprint() const noexcept {
+	return (m_instructions.capacity() + m_addresses.capacity()) * sizeof(uint64_t);
+}
+
 void EightBit::Profiler::dump() const {
 	dumpInstructionProfiles();
 	dumpAddressProfiles();
@@ -3,9 +3,10 @@
 
 // based on http://www.z80.info/decoding.htm
 
-EightBit::Z80::Z80(Bus& bus, InputOutput& ports) noexcept
+EightBit::Z80::Z80(Bus& bus, InputOutput& ports, const mode_t mode) noexcept
 : base(bus),
-  m_ports(ports) {
+  m_ports(ports),
+  m_mode(mode) {
 	RaisedPOWER.connect([this](EventArgs) {
 
 		raiseM1();
@@ -48,6 +49,7 @@ EightBit::Z80::Z80(Bus& bus, InputOutput& ports) noexcept
 EightBit::Z80::Z80(const Z80& rhs) noexcept
 : base(rhs),
   m_ports(rhs.m_ports),
+  m_mode(rhs.m_mode),
   m_registers(rhs.m_registers),
   m_registerSet(rhs.m_registerSet),
   m_accumulatorFlags(rhs.m_accumulatorFlags),
@@ -148,12 +150,17 @@ void EightBit::Z80::memoryUpdate(int ticks) noexcept {
 	assert(ticks > 0 && "Ticks must be greater than zero");
 	WritingMemory.fire();
 	tick(ticks);
-	lowerMREQ();
-		lowerWR();
-			tick();
-			base::memoryWrite();
-		raiseWR();
-	raiseMREQ();
+	if (m_quiet) {
+		tick();
+		base::memoryWrite();
+	} else {
+		lowerMREQ();
+			lowerWR();
+				tick();
+				base::memoryWrite();
+			raiseWR();
+		raiseMREQ();
+	}
 	tick();
 	WrittenMemory.fire();
 }
@@ -165,22 +172,32 @@ void EightBit::Z80::memoryWrite() noexcept {
 void EightBit::Z80::refreshMemory() noexcept {
 	assert(fetchingOpCode() && "M1 must be lowered to refresh memory");
 	BUS().ADDRESS() = { REFRESH(), IV() };
-	lowerRFSH();
+	if (m_quiet) {
 		tick();
-		lowerMREQ();
-		raiseMREQ();
-	raiseRFSH();
+		++REFRESH();
+	} else {
+		lowerRFSH();
+			tick();
+			lowerMREQ();
+			raiseMREQ();
+		raiseRFSH();
+	}
 }
 
 void EightBit::Z80::memoryRead() noexcept {
 	ReadingMemory.fire();
 	tick();
-	lowerMREQ();
-		lowerRD();
-			tick();
-			base::memoryRead();
-		raiseRD();
-	raiseMREQ();
+	if (m_quiet) {
+		tick();
+		base::memoryRead();
+	} else {
+		lowerMREQ();
+			lowerRD();
+				tick();
+				base::memoryRead();
+			raiseRD();
+		raiseMREQ();
+	}
 	if (fetchingOpCode())
 		refreshMemory();
 	tick();
@@ -247,6 +264,52 @@ void EightBit::Z80::handleINT() noexcept {
 	}
 }
 
+// Anything sampling the pins each cycle counts as watching them
+bool EightBit::Z80::observed() noexcept {
+	return Ticked.attached()
+		|| PIN_ATTACHED(M1) || PIN_ATTACHED(RFSH) || PIN_ATTACHED(MREQ)
+		|| PIN_ATTACHED(IORQ) || PIN_ATTACHED(RD) || PIN_ATTACHED(WR);
+}
+
+// Halted, or an unprefixed jump to itself
+bool EightBit::Z80::spinning() noexcept {
+
+	if (m_resetPending || m_nonMaskableInterruptPending || m_interruptPending || m_threaded)
+		return false;
+
+	if (PIN_OBSERVED(M1) || PIN_OBSERVED(MREQ) || PIN_OBSERVED(RD) || PIN_OBSERVED(RFSH))
+		return false;
+
+	if (halted())
+		return true;
+
+	if (m_page != Unprefixed)
+		return false;
+
+	switch (opcode()) {
+	case 0x18:											// JR d
+	case 0x20: case 0x28: case 0x30: case 0x38:			// JR cc,d
+	case 0xc3:											// JP nn
+	case 0xc2: case 0xca: case 0xd2: case 0xda:			// JP cc,nn
+	case 0xe2: case 0xea: case 0xf2: case 0xfa:
+	case 0xe9:											// JP (HL)
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Every iteration has a single M1 cycle, so R moves on by one each time
+void EightBit::Z80::spin(const uint64_t iterations) noexcept {
+	const uint8_t r = REFRESH();
+	const auto refreshed = [r](const uint64_t count) {
+		return static_cast<uint8_t>((r & Bit7) | ((r + count) & Mask7));
+	};
+	if (halted() || (opcode() == 0xe9))
+		BUS().ADDRESS() = { refreshed(iterations - 1), IV() };	// Nothing was read after the refresh
+	REFRESH() = refreshed(iterations);
+}
+
 void EightBit::Z80::disableInterrupts() noexcept {
 	IFF1() = IFF2() = false;
 }
@@ -536,13 +599,19 @@ void EightBit::Z80::bit(int n, uint8_t operand) noexcept {
 }
 
 void EightBit::Z80::daa() noexcept {
+	const auto adjusted = m_daa[daaIndex(A(), F())];
+	adjustStatusFlags(adjusted.low);
+	A() = adjusted.high;
+}
 
-	auto updated = A();
+constexpr EightBit::register16_t EightBit::Z80::decimalAdjust(const uint8_t a, const uint8_t f) noexcept {
 
-	const auto lowAdjust = halfCarry() || (lowNibble(A()) > 9);
-	const auto highAdjust = carry() || (A() > 0x99);
+	uint8_t updated = a;
 
-	if (subtracting()) {
+	const auto lowAdjust = halfCarryTest(f) || (lowNibble(a) > 9);
+	const auto highAdjust = carryTest(f) || (a > 0x99);
+
+	if (subtractingTest(f)) {
 		if (lowAdjust)
 			updated -= 6;
 		if (highAdjust)
@@ -554,10 +623,19 @@ void EightBit::Z80::daa() noexcept {
 			updated += 0x60;
 	}
 
-	adjustStatusFlags((F() & (CF | NF) | (A() > 0x99 ? CF : 0) | halfCarryTest(A() ^ updated)));
-	adjustSZPXY(A() = updated);
+	const uint8_t flags = (f & (CF | NF)) | (a > 0x99 ? CF : 0) | halfCarryTest(a ^ updated);
+	return { adjustSZPXY(flags, updated), updated };
 }
 
+constexpr std::array<EightBit::register16_t, 0x800> EightBit::Z80::m_daa = [] {
+	std::array<register16_t, 0x800> adjusted;
+	for (int index = 0; index < 0x800; ++index) {
+		const uint8_t f = ((index >> 8) & (CF | NF)) | ((index >> 6) & HC);
+		adjusted[index] = decimalAdjust(index & Mask8, f);
+	}
+	return adjusted;
+}();
+
 void EightBit::Z80::scf() noexcept {
 	if (displaced())
 		Q() = 0;
@@ -694,6 +772,127 @@ void EightBit::Z80::repeatBlockInstruction() noexcept {
 	tick(5);
 }
 
+void EightBit::Z80::repeat(const iteration_t iteration, const skip_t skip) noexcept {
+	const auto following = PC();
+	(this->*iteration)();
+	auto remaining = repeatable();
+	while ((remaining > 0) && (PC() != following) && refetchable()) {
+		if ((skip != nullptr) && (remaining > 1) && (BC().joined > 1)) {
+			// The last iteration always runs in full, to leave the flags as it would
+			const auto skipped = (this->*skip)(std::min<size_t>(remaining - 1, BC().joined - 1));
+			if (skipped > 0) {
+				tick(static_cast<int>(skipped) * RepeatCycles);
+				REFRESH() += static_cast<int>(skipped) * 2;
+				remaining -= static_cast<int>(skipped);
+				continue;
+			}
+		}
+		refetch();
+		(this->*iteration)();
+		--remaining;
+	}
+}
+
+// Nothing may watch or trap instructions, memory or pins, no interrupt may be pending,
+// and none may be raised by the scheduler before the iterations would have finished.
+int EightBit::Z80::repeatable() noexcept {
+	if (observed() || base::observed() || trapped(PC()) || m_resetPending || m_nonMaskableInterruptPending || m_interruptPending)
+		return 0;
+	const auto& scheduler = BUS().scheduler();
+	const auto now = scheduler.now() + cycles();
+	if (now >= scheduler.next())
+		return 0;
+	const auto iterations = (scheduler.next() - now + RepeatCycles - 1) / RepeatCycles;
+	return static_cast<int>(std::min<uint64_t>(iterations, 0x10000));
+}
+
+// Block instructions are able to overwrite themselves
+bool EightBit::Z80::refetchable() noexcept {
+	return (BUS().peek(PC()) == 0xed) && (BUS().peek(uint16_t(PC().joined + 1)) == opcode());
+}
+
+bool EightBit::Z80::overwrites(const uint8_t* const begin, const size_t count) noexcept {
+	for (const register16_t address : { PC(), register16_t(PC().joined + 1) }) {
+		const auto* const page = BUS().readable(address.high);
+		if (page == nullptr)
+			return true;
+		const auto* const location = page + address.low;
+		if ((location >= begin) && (location < begin + count))
+			return true;
+	}
+	return false;
+}
+
+// The prefix and opcode are fetched again, but needn't be decoded
+void EightBit::Z80::refetch() noexcept {
+	m_modifiedF = 0;
+	PC().joined += 2;
+	tick(8);
+	REFRESH() += 2;
+}
+
+// LDIR/LDDR iterations, up to the first page boundary.  Sequential copying differs from
+// "memmove" only when the destination overlaps the source ahead of it, e.g. when filling.
+template<int Direction>
+size_t EightBit::Z80::skipLoads(const size_t limit) noexcept {
+
+	const auto source = HL();
+	const auto destination = DE();
+
+	const auto* const sourcePage = BUS().readable(source.high);
+	auto* const destinationPage = BUS().writable(destination.high);
+	if ((sourcePage == nullptr) || (destinationPage == nullptr))
+		return 0;
+
+	const auto room = [](const uint8_t offset) { return size_t(Direction > 0 ? 0x100 - offset : offset + 1); };
+	const auto count = std::min({ limit, room(source.low), room(destination.low) });
+
+	const auto* const from = sourcePage + source.low;
+	auto* const to = destinationPage + destination.low;
+	auto* const lowest = Direction > 0 ? to : to - (count - 1);
+	if (overwrites(lowest, count))
+		return 0;
+
+	const auto distance = (reinterpret_cast<intptr_t>(to) - reinterpret_cast<intptr_t>(from)) * Direction;
+	if ((distance > 0) && (size_t(distance) < count)) {
+		for (size_t i = 0; i < count; ++i)
+			to[i * Direction] = from[i * Direction];
+	} else {
+		std::memmove(lowest, Direction > 0 ? from : from - (count - 1), count);
+	}
+
+	HL().joined += int(count) * Direction;
+	DE().joined += int(count) * Direction;
+	BC().joined -= uint16_t(count);
+	return count;
+}
+
+// CPIR/CPDR iterations, up to the first match or page boundary
+template<int Direction>
+size_t EightBit::Z80::skipCompares(const size_t limit) noexcept {
+
+	const auto address = HL();
+	const auto* const page = BUS().readable(address.high);
+	if (page == nullptr)
+		return 0;
+
+	const auto count = std::min(limit, size_t(Direction > 0 ? 0x100 - address.low : address.low + 1));
+	const auto* const from = page + address.low;
+
+	size_t skipped = 0;
+	if constexpr (Direction > 0) {
+		const auto* const found = static_cast<const uint8_t*>(std::memchr(from, A(), count));
+		skipped = found == nullptr ? count : found - from;
+	} else {
+		while ((skipped < count) && (from[-int(skipped)] != A()))
+			++skipped;
+	}
+
+	HL().joined += int(skipped) * Direction;
+	BC().joined -= uint16_t(skipped);
+	return skipped;
+}
+
 void EightBit::Z80::adjustBlockRepeatFlagsIO() noexcept {
 	auto direction = B();
 	if (carry() != 0) {
@@ -834,12 +1033,17 @@ void EightBit::Z80::writePort(const uint8_t port) noexcept {
 void EightBit::Z80::writePort() noexcept {
 	MEMPTR() = BUS().ADDRESS();
 	tick(2);
-	lowerIORQ();
-		lowerWR();
-			tick();
-			m_ports.write(BUS().ADDRESS(), BUS().DATA());
-		raiseWR();
-	raiseIORQ();
+	if (m_quiet) {
+		tick();
+		m_ports.write(BUS().ADDRESS(), BUS().DATA());
+	} else {
+		lowerIORQ();
+			lowerWR();
+				tick();
+				m_ports.write(BUS().ADDRESS(), BUS().DATA());
+			raiseWR();
+		raiseIORQ();
+	}
 	tick();
 }
 
@@ -857,12 +1061,17 @@ void EightBit::Z80::readPort(const uint8_t port) noexcept {
 void EightBit::Z80::readPort() noexcept {
 	MEMPTR() = BUS().ADDRESS();
 	tick(2);
-	lowerIORQ();
-		lowerRD();
-			BUS().DATA() = m_ports.read(BUS().ADDRESS());
-			tick();
-		raiseRD();
-	raiseIORQ();
+	if (m_quiet) {
+		BUS().DATA() = m_ports.read(BUS().ADDRESS());
+		tick();
+	} else {
+		lowerIORQ();
+			lowerRD();
+				BUS().DATA() = m_ports.read(BUS().ADDRESS());
+				tick();
+			raiseRD();
+		raiseIORQ();
+	}
 	tick();
 }
 
@@ -903,6 +1112,13 @@ void EightBit::Z80::fetchDisplacement() noexcept {
 // CPU.The HALT acknowledge signal is active during this time indicating that the processor
 // is in the HALT state
 uint8_t EightBit::Z80::fetchInstruction() noexcept {
+	if (m_quiet) {
+		// The level alone is still needed, to refresh memory
+		lower(M1());
+		const auto data = base::fetchInstruction();
+		raise(M1());
+		return data;
+	}
 	lowerM1();
 		const auto data = base::fetchInstruction();
 	raiseM1();
@@ -917,10 +1133,8 @@ void EightBit::Z80::readInternalRegister(reader_t reader) noexcept {
 }
 
 EightBit::register16_t& EightBit::Z80::HL2() noexcept {
-	if (m_prefixDD)
-		return IX();
-	if (m_prefixFD)
-		return IY();
+	if (displaced())
+		return indexedByIX() ? IX() : IY();
 	return HL();
 }
 
@@ -1025,7 +1239,9 @@ void EightBit::Z80::R2(const int r, const uint8_t value) noexcept {
 void EightBit::Z80::poweredStep() noexcept {
 
 	m_modifiedF = 0;
-	m_prefixCB = m_prefixDD = m_prefixED = m_prefixFD = false;
+	m_page = Unprefixed;
+	m_quiet = (mode() == mode_t::Fast) && !observed();
+	m_threaded = false;
 
 	if (m_resetPending) {
 		m_resetPending = false;
@@ -1043,14 +1259,254 @@ void EightBit::Z80::poweredStep() noexcept {
 		}
 	}
 
+	if (m_caching && m_quiet && proceeding() && !ReadingMemory.attached() && !ReadMemory.attached()) {
+		if (const auto* const instruction = cached()) {
+			thread(instruction);
+			return;
+		}
+	}
+
 	base::execute(fetchInstruction());
 
 	Q() = m_modifiedF;
 }
 
 void EightBit::Z80::execute() noexcept {
+	m_handlers[m_page][opcode()](*this);
+}
+
+void EightBit::Z80::cache(const bool enabled) noexcept {
+	if (enabled == m_caching)
+		return;
+	m_caching = enabled;
+	if (enabled) {
+		m_cache.resize(0x100);
+		m_invalidation = BUS().WrittenWatchedPage.connect([this](const register16_t address) {
+			invalidate(address);
+		});
+	} else {
+		flush();
+		m_cache.clear();
+		m_cache.shrink_to_fit();
+		m_invalidation.disconnect();
+	}
+}
+
+void EightBit::Z80::flush() noexcept {
+	for (size_t page = 0; page < m_cache.size(); ++page) {
+		if (m_cache[page] != nullptr) {
+			BUS().unwatch(static_cast<uint8_t>(page));
+			m_cache[page].reset();
+		}
+	}
+}
+
+size_t EightBit::Z80::footprint() const noexcept {
+	const auto pages = std::count_if(m_cache.cbegin(), m_cache.cend(), [](const auto& page) { return page != nullptr; });
+	return m_cache.capacity() * sizeof(m_cache[0]) + pages * sizeof(cached_page_t);
+}
+
+// The instruction at PC, decoded when first run from wherever its page is mapped.
+// Null if it can't be cached, e.g. an instruction spanning pages.
+const EightBit::Z80::cached_t* EightBit::Z80::cached() noexcept {
+
+	const auto pc = PC();
+	const auto* const storage = BUS().readable(pc.high);
+	if (storage == nullptr)
+		return nullptr;
+
+	auto& page = m_cache[pc.high];
+	if (page == nullptr) {
+		page = std::make_unique<cached_page_t>();
+		BUS().watch(pc.high);
+	}
+
+	// Remapped, or bank switched
+	if (page->storage != storage) {
+		page->storage = storage;
+		page->aliased = aliased(pc.high);
+		++page->stamp;
+	}
+
+	if (page->aliased)
+		return nullptr;
+
+	auto& instruction = page->instructions[pc.low];
+	if (instruction.stamp != page->stamp) {
+		decode(storage, pc.low, instruction);
+		instruction.stamp = page->stamp;
+	}
+
+	return instruction.handler == nullptr ? nullptr : &instruction;
+}
+
+// Writes through another page wouldn't be seen
+bool EightBit::Z80::aliased(const uint8_t page) noexcept {
+	const auto* const storage = BUS().readable(page);
+	for (int other = 0; other < 0x100; ++other) {
+		const auto* const candidate = BUS().readable(other);
+		if ((other != page) && (candidate != nullptr) && (candidate < storage + 0x100) && (storage < candidate + 0x100))
+			return true;
+	}
+	return false;
+}
+
+void EightBit::Z80::decode(const uint8_t* const storage, const uint8_t offset, cached_t& instruction) noexcept {
+
+	instruction.handler = nullptr;
+
+	page_t page = Unprefixed;
+	switch (storage[offset]) {
+	case 0xcb:
+		page = CB;
+		break;
+	case 0xdd:
+		page = DD;
+		break;
+	case 0xed:
+		page = ED;
+		break;
+	case 0xfd:
+		page = FD;
+		break;
+	}
+
+	const auto fetches = page == Unprefixed ? 1 : 2;
+	if (offset + fetches > 0x100)
+		return;
+
+	const auto opcode = storage[offset + fetches - 1];
+
+	// Displaced bit instructions, and chained prefixes, are left to the decoder
+	if (displaced(page)) {
+		switch (opcode) {
+		case 0xcb: case 0xdd: case 0xed: case 0xfd:
+			return;
+		}
+	}
+
+	// Never spanning pages, so the whole instruction is watched along with its page
+	const auto count = operands(page, opcode);
+	const auto length = fetches + count;
+	if (offset + length > 0x100)
+		return;
+
+	instruction.handler = m_handlers[page][opcode];
+	instruction.opcode = opcode;
+	instruction.page = page;
+	instruction.fetches = fetches;
+	instruction.cycles = 4 * fetches + 3 * count;
+	instruction.ends = ends(page, opcode);
+	for (int i = 0; i < count; ++i)
+		instruction.operands[i] = storage[offset + fetches + i];
+}
+
+// Drops any cached instruction the written byte may be part of
+void EightBit::Z80::invalidate(const register16_t address) noexcept {
+	auto& page = m_cache[address.high];
+	if (page == nullptr)
+		return;
+	const auto first = std::max(0, address.low - (MaximumLength - 1));
+	for (int offset = first; offset <= address.low; ++offset)
+		page->instructions[offset].stamp = 0;
+}
+
+// Every instruction up to the next change of flow (or trap), unless something needs to see
+// each instruction, or anything (an interrupt, or the scheduler) could intervene between them.
+void EightBit::Z80::thread(const cached_t* instruction) noexcept {
+	const auto threading = !base::observed();
+	const auto& scheduler = BUS().scheduler();
+	while (true) {
+		startInstruction();
+		run(*instruction);
+		Q() = m_modifiedF;
+		if (!threading || instruction->ends || !powered())
+			return;
+		if (m_resetPending || m_nonMaskableInterruptPending || m_interruptPending)
+			return;
+		if (scheduler.now() + cycles() >= scheduler.next())
+			return;
+		if (trapped(PC()))
+			return;
+		instruction = cached();
+		if (instruction == nullptr)
+			return;
+		m_threaded = true;
+		m_modifiedF = 0;
+	}
+}
+
+// Leaves everything as fetching the instruction would have.  The cycles taken by
+// the fetches are all ticked up front, and the handler is given its operands
+// without going back to the bus.
+void EightBit::Z80::run(const cached_t& instruction) noexcept {
+	PC().joined += instruction.fetches;
+	for (int i = 0; i < instruction.fetches; ++i) {
+		BUS().ADDRESS() = { REFRESH(), IV() };
+		++REFRESH();
+	}
+	BUS().DATA() = instruction.opcode;
+	tick(instruction.cycles);
+	m_page = static_cast<page_t>(instruction.page);
+	opcode() = instruction.opcode;
+	m_operand = instruction.operands.data();
+	instruction.handler(*this);
+	m_operand = nullptr;
+}
+
+// Operands of a cached instruction were read when it was decoded, and have been ticked for
+void EightBit::Z80::fetchByte() noexcept {
+	if (m_operand == nullptr) {
+		base::fetchByte();
+		return;
+	}
+	BUS().ADDRESS() = PC()++;
+	BUS().DATA() = *m_operand++;
+}
+
+// Branches, calls, returns, restarts, halts, repeats and interrupt control
+constexpr bool EightBit::Z80::ends(const page_t page, const uint8_t opcode) noexcept {
+
+	const auto x = (opcode & 0b11000000) >> 6;
+	const auto y = (opcode & 0b111000) >> 3;
+	const auto z = (opcode & 0b111);
+
+	switch (page) {
+	case CB:
+		return false;
+	case ED:
+		return ((x == 1) && (z == 5)) || ((x == 2) && (y >= 6) && (z <= 3));
+	default:
+		break;
+	}
+
+	switch (x) {
+	case 0:
+		return (z == 0) && (y >= 2);
+	case 1:
+		return opcode == 0x76;
+	case 3:
+		switch (z) {
+		case 0: case 2: case 4: case 7:
+			return true;
+		case 1:
+			return (opcode == 0xc9) || (opcode == 0xe9);
+		case 3:
+			return (opcode == 0xc3) || (opcode == 0xf3) || (opcode == 0xfb);
+		case 5:
+			return opcode == 0xcd;
+		default:
+			return false;
+		}
+	default:
+		return false;
+	}
+}
 
-	const auto& decoded = getDecodedOpcode(opcode());
+// Immediate operand bytes, including any (IX+d)/(IY+d) displacement
+constexpr int EightBit::Z80::operands(const page_t page, const uint8_t opcode) noexcept {
+
+	const opcode_decoded_t decoded(opcode);
 
 	const auto x = decoded.x;
 	const auto y = decoded.y;
@@ -1059,22 +1515,122 @@ void EightBit::Z80::execute() noexcept {
 	const auto p = decoded.p;
 	const auto q = decoded.q;
 
-	if (m_prefixCB)
-		executeCB(x, y, z);
-	else if (m_prefixED)
-		executeED(x, y, z, p, q);
+	switch (page) {
+	case CB:
+		return 0;
+	case ED:
+		return (x == 1) && (z == 3) ? 2 : 0;		// LD (nn),rp and LD rp,(nn)
+	default:
+		break;
+	}
+
+	const auto memoryY = y == 6;
+	const auto memoryZ = z == 6;
+	const auto displacement = displaced(page) && (
+		((x == 0) && memoryY && (z >= 4) && (z <= 6))	// INC/DEC (i+d), LD (i+d),n
+		|| ((x == 1) && (memoryY != memoryZ))			// LD r,(i+d) and LD (i+d),r
+		|| ((x == 2) && memoryZ)) ? 1 : 0;				// alu[y] (i+d)
+
+	switch (x) {
+	case 0:
+		switch (z) {
+		case 0:
+			return y >= 2 ? 1 : 0;						// DJNZ d, JR d, JR cc,d
+		case 1:
+			return q == 0 ? 2 : 0;						// LD rp,nn
+		case 2:
+			return y >= 4 ? 2 : 0;						// LD (nn),HL, LD HL,(nn), LD (nn),A, LD A,(nn)
+		case 6:
+			return displacement + 1;					// LD r,n
+		default:
+			return displacement;
+		}
+	case 3:
+		switch (z) {
+		case 2:											// JP cc,nn
+		case 4:											// CALL cc,nn
+			return 2;
+		case 3:
+			return y == 0 ? 2 : (y == 2) || (y == 3) ? 1 : 0;	// JP nn, OUT (n),A, IN A,(n)
+		case 5:
+			return (q == 1) && (p == 0) ? 2 : 0;		// CALL nn
+		case 6:
+			return 1;									// alu[y] n
+		default:
+			return 0;
+		}
+	default:
+		return displacement;
+	}
+}
+
+// Each handler is one of the generic page handlers below, specialised for a single
+// opcode: the decoded fields (and any displacement) are constant, so the compiler
+// is left with just the path taken by that opcode.
+
+template<EightBit::Z80::page_t Page, uint8_t Opcode>
+void EightBit::Z80::dispatch(Z80& cpu) noexcept {
+	if constexpr (Page == CB)
+		cpu.executeCB<false, Opcode>();
+	else if constexpr (Page == DDCB)
+		cpu.executeCB<true, Opcode>();
+	else if constexpr (Page == ED)
+		cpu.executeED<Opcode>();
+	else
+		cpu.executeOther<Page == DD, Opcode>();
+}
+
+// IX and IY share their handlers, and most of the DD/FD page is the unprefixed
+// handler itself: "HL2" and "R" pick up the index register as they run.  Only
+// the (IX+d)/(IY+d) operands change the shape of an instruction.
+constexpr bool EightBit::Z80::displacing(const uint8_t opcode) noexcept {
+	const opcode_decoded_t decoded(opcode);
+	switch (decoded.x) {
+	case 0:
+		return (decoded.y == 6) && ((decoded.z == 4) || (decoded.z == 5));
+	case 1:
+		return ((decoded.y == 6) != (decoded.z == 6));
+	case 2:
+		return decoded.z == 6;
+	default:
+		return false;
+	}
+}
+
+template<EightBit::Z80::page_t Page, uint8_t Opcode>
+constexpr EightBit::Z80::handler_t EightBit::Z80::handler() noexcept {
+	if constexpr ((Page == DD || Page == FD) && !displacing(Opcode))
+		return &dispatch<Unprefixed, Opcode>;
+	else if constexpr (Page == FD)
+		return &dispatch<DD, Opcode>;
+	else if constexpr (Page == FDCB)
+		return &dispatch<DDCB, Opcode>;
 	else
-		executeOther(x, y, z, p, q);
+		return &dispatch<Page, Opcode>;
+}
+
+template<EightBit::Z80::page_t Page, size_t... Opcodes>
+constexpr EightBit::Z80::handlers_t EightBit::Z80::handlers(std::index_sequence<Opcodes...>) noexcept {
+	return { { handler<Page, Opcodes>()... } };
 }
 
-void EightBit::Z80::executeCB(const int x, const int y, const int z) noexcept {
+template<bool Indexed, uint8_t Opcode>
+void EightBit::Z80::executeCB() noexcept {
+
+	constexpr opcode_decoded_t decoded(Opcode);
+
+	constexpr auto x = decoded.x;
+	constexpr auto y = decoded.y;
+	constexpr auto z = decoded.z;
+
+	constexpr auto indexed = Indexed;
 
 	const bool memoryZ = z == 6;
-	const bool indirect = (!displaced() && memoryZ) || displaced();
+	const bool indirect = (!indexed && memoryZ) || indexed;
 	const auto direct = !indirect;
 
 	uint8_t operand;
-	if (displaced()) {
+	if (indexed) {
 		tick(2);
 		displaceAddress();
 		memoryRead();
@@ -1132,7 +1688,7 @@ void EightBit::Z80::executeCB(const int x, const int y, const int z) noexcept {
 		UNREACHABLE;
 	}
 	if (update) {
-		if (displaced()) {
+		if (indexed) {
 			tick();
 			base::memoryWrite(operand);
 			if (!memoryZ)
@@ -1143,7 +1699,17 @@ void EightBit::Z80::executeCB(const int x, const int y, const int z) noexcept {
 	}
 }
 
-void EightBit::Z80::executeED(const int x, const int y, const int z, const int p, const int q) noexcept {
+template<uint8_t Opcode>
+void EightBit::Z80::executeED() noexcept {
+
+	constexpr opcode_decoded_t decoded(Opcode);
+
+	constexpr auto x = decoded.x;
+	constexpr auto y = decoded.y;
+	constexpr auto z = decoded.z;
+
+	constexpr auto p = decoded.p;
+	constexpr auto q = decoded.q;
 
 	switch (x) {
 	case 0:
@@ -1267,10 +1833,10 @@ void EightBit::Z80::executeED(const int x, const int y, const int z, const int p
 				ldd();
 				break;
 			case 6:	// LDIR
-				ldir();
+				repeat(&Z80::ldir, &Z80::skipLoads<+1>);
 				break;
 			case 7:	// LDDR
-				lddr();
+				repeat(&Z80::lddr, &Z80::skipLoads<-1>);
 				break;
 			}
 			break;
@@ -1283,10 +1849,10 @@ void EightBit::Z80::executeED(const int x, const int y, const int z, const int p
 				cpd();
 				break;
 			case 6:	// CPIR
-				cpir();
+				repeat(&Z80::cpir, &Z80::skipCompares<+1>);
 				break;
 			case 7:	// CPDR
-				cpdr();
+				repeat(&Z80::cpdr, &Z80::skipCompares<-1>);
 				break;
 			}
 			break;
@@ -1299,10 +1865,10 @@ void EightBit::Z80::executeED(const int x, const int y, const int z, const int p
 				ind();
 				break;
 			case 6:	// INIR
-				inir();
+				repeat(&Z80::inir);
 				break;
 			case 7:	// INDR
-				indr();
+				repeat(&Z80::indr);
 				break;
 			}
 			break;
@@ -1315,10 +1881,10 @@ void EightBit::Z80::executeED(const int x, const int y, const int z, const int p
 				outd();
 				break;
 			case 6:	// OTIR
-				otir();
+				repeat(&Z80::otir);
 				break;
 			case 7:	// OTDR
-				otdr();
+				repeat(&Z80::otdr);
 				break;
 			}
 			break;
@@ -1327,7 +1893,20 @@ void EightBit::Z80::executeED(const int x, const int y, const int z, const int p
 	}
 }
 
-void EightBit::Z80::executeOther(const int x, const int y, const int z, const int p, const int q) noexcept {
+template<bool Indexed, uint8_t Opcode>
+void EightBit::Z80::executeOther() noexcept {
+
+	constexpr opcode_decoded_t decoded(Opcode);
+
+	constexpr auto x = decoded.x;
+	constexpr auto y = decoded.y;
+	constexpr auto z = decoded.z;
+
+	constexpr auto p = decoded.p;
+	constexpr auto q = decoded.q;
+
+	constexpr auto indexed = Indexed;
+
 	const bool memoryY = y == 6;
 	const bool memoryZ = z == 6;
 	switch (x) {
@@ -1434,7 +2013,7 @@ void EightBit::Z80::executeOther(const int x, const int y, const int z, const in
 			tick(2);
 			break;
 		case 4: { // 8-bit INC
-			if (memoryY && displaced()) {
+			if (memoryY && indexed) {
 				fetchDisplacement();
 				tick(5);
 			}
@@ -1443,7 +2022,7 @@ void EightBit::Z80::executeOther(const int x, const int y, const int z, const in
 			break;
 		}
 		case 5: { // 8-bit DEC
-			if (memoryY && displaced()) {
+			if (memoryY && indexed) {
 				fetchDisplacement();
 				tick(5);
 			}
@@ -1492,7 +2071,7 @@ void EightBit::Z80::executeOther(const int x, const int y, const int z, const in
 	case 1:	// 8-bit loading
 		if (!(memoryZ && memoryY)) {
 			bool normal = true;
-			if (displaced()) {
+			if (indexed) {
 				if (memoryZ || memoryY) {
 					fetchDisplacement();
 					tick(5);
@@ -1529,7 +2108,7 @@ void EightBit::Z80::executeOther(const int x, const int y, const int z, const in
 		}
 		break;
 	case 2: { // Operate on accumulator and register/memory location
-		if (memoryZ && displaced()) {
+		if (memoryZ && indexed) {
 			fetchDisplacement();
 			tick(5);
 		}
@@ -1726,27 +2305,38 @@ void EightBit::Z80::pushRegisterPair(int p) {
 }
 
 void EightBit::Z80::prefixDD() {
-	m_prefixDD = true;
+	m_page = DD;
 	base::execute(fetchInstruction());
 }
 
 void EightBit::Z80::prefixED() {
-	m_prefixED = true;
+	m_page = ED;
 	base::execute(fetchInstruction());
 }
 
 void EightBit::Z80::prefixFD() {
-	m_prefixFD = true;
+	m_page = FD;
 	base::execute(fetchInstruction());
 }
 
 void EightBit::Z80::prefixCB() {
-	m_prefixCB = true;
 	if (displaced()) {
+		m_page = indexedByIX() ? DDCB : FDCB;
 		fetchDisplacement();
 		fetchByte();
 		base::execute(BUS().DATA());
 	} else {
+		m_page = CB;
 		base::execute(fetchInstruction());
 	}
 }
+
+constexpr std::array<EightBit::Z80::handlers_t, EightBit::Z80::Pages> EightBit::Z80::m_handlers = { {
+	handlers<Unprefixed>(std::make_index_sequence<0x100>()),
+	handlers<CB>(std::make_index_sequence<0x100>()),
+	handlers<ED>(std::make_index_sequence<0x100>()),
+	handlers<DD>(std::make_index_sequence<0x100>()),
+	handlers<FD>(std::make_index_sequence<0x100>()),
+	handlers<DDCB>(std::make_index_sequence<0x100>()),
+	handlers<FDCB>(std::make_index_sequence<0x100>()),
+} };
@@ -5,12 +5,14 @@
 #include <string>
 #include <cstdint>
 #include <cassert>
+#include <cstring>
 
 #include <sstream>
 #include <iostream>
 #include <iomanip>
 #include <functional>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 
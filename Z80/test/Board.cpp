@@ -2,7 +2,9 @@
 #include "Board.h"
 
 Board::Board(const Configuration& configuration)
-: m_configuration(configuration) {}
+: m_configuration(configuration) {
+	m_cpu.cache(true);
+}
 
 void Board::raisePOWER() noexcept {
 	EightBit::Bus::raisePOWER();
@@ -26,23 +28,18 @@ void Board::initialise() noexcept {
 		lowerPOWER();
 	});
 	
-	m_cpu.ExecutingInstruction.connect([this] (EightBit::EventArgs) {
-		switch (m_cpu.PC().joined) {
-		case 0x0:	// CP/M warm start
-			if (++m_warmstartCount == 2) {
-				lowerPOWER();
-				if (m_configuration.isProfileMode())
-					m_profiler.dump();
-			}
-			break;
-		case 0x5:	// BDOS
-			bdos();
-			break;
-		default:
-			break;
+	m_cpu.trap(0x0, [this] (EightBit::EventArgs&) {	// CP/M warm start
+		if (++m_warmstartCount == 2) {
+			lowerPOWER();
+			if (m_configuration.isProfileMode())
+				m_profiler.dump();
 		}
 	});
 
+	m_cpu.trap(0x5, [this] (EightBit::EventArgs&) {	// BDOS
+		bdos();
+	});
+
 	if (m_configuration.isProfileMode())
 		m_cpu.ExecutingInstruction.connect([this] (EightBit::EventArgs) {
 			const auto pc = m_cpu.PC();
@@ -62,6 +59,8 @@ void Board::initialise() noexcept {
 	poke(0, 0xc3);	// JMP
 	CPU().pokeShort(1, m_configuration.getStartAddress());
 	poke(5, 0xc9);	// ret
+
+	remap();
 }
 
 void Board::bdos() {
@@ -23,8 +23,12 @@ public:
 
 	void initialise() noexcept final;
 
+	[[nodiscard]] size_t footprint() noexcept final {
+		return EightBit::Bus::footprint() + m_ports.footprint() + m_profiler.footprint() + m_cpu.footprint();
+	}
+
 protected:
-	const EightBit::MemoryMapping& mapping(uint16_t address) noexcept final {
+	EightBit::MemoryMapping mapping(uint16_t address) noexcept final {
 		return m_mapping;
 	}
 
@@ -32,7 +36,7 @@ private:
 	const Configuration& m_configuration;
 	EightBit::Ram m_ram = 0x10000;
 	EightBit::InputOutput m_ports;
-	EightBit::Z80 m_cpu{ *this, m_ports };
+	EightBit::Z80 m_cpu{ *this, m_ports, EightBit::Z80::mode_t::Fast };
 	EightBit::Disassembler m_disassembler = *this;
 	EightBit::Profiler m_profiler = { m_cpu, m_disassembler };
 	const EightBit::MemoryMapping m_mapping = { m_ram, 0x0000, 0xffff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
@@ -4,7 +4,7 @@
 
 #include <TestHarness.h>
 
-int main(int, char*[]) {
+int main(int argc, char* argv[]) {
 
 	Configuration configuration;
 
@@ -14,6 +14,8 @@ int main(int, char*[]) {
 #endif
 
 	EightBit::TestHarness<Configuration, Board> harness(configuration);
+	if (!harness.parse(argc, argv))
+		return 1;
 	harness.run();
 
 	return 0;
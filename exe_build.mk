@@ -1,4 +1,4 @@
-LDFLAGS += -g
+LDFLAGS += -g -pthread
 
 LDFLAGS_OPT = -flto
 LDFLAGS_COVERAGE = -lgcov
@@ -13,6 +13,14 @@ profile: LDFLAGS += $(LDFLAGS_PROFILE)
 profile: $(EXE)
 profiled: $(EXE)
 
+# The cost of observing the processor: the same fixed budget, without and then with every signal attached
+BENCHMARK = --warmup 1 --runs 5 --budget 1000000000
+
+.PHONY: benchmark
+benchmark: $(EXE)
+	./$(EXE) $(BENCHMARK) --observe none
+	./$(EXE) $(BENCHMARK) --observe all
+
 $(EXE): $(OBJECTS)
 	$(CXX) $(OBJECTS) -o $(EXE) $(LDFLAGS)
 
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "Chip.h"
+#include "Delegate.h"
 #include "Signal.h"
 #include "Register.h"
 #include "EventArgs.h"
 #include "Mapper.h"
+#include "Scheduler.h"
+#include "WatchpointEventArgs.h"
+#include "EightBitCompilerDefinitions.h"
 
 namespace EightBit {
 	class Bus : public Mapper {
@@ -30,21 +38,130 @@ namespace EightBit {
 		void poke(const uint16_t address, const uint8_t value) noexcept { reference(address) = value; }
 		void poke(const register16_t address, const uint8_t value) noexcept { poke(address.joined, value); }
 
-		void read() noexcept;
-		void write() noexcept;
+		void read() noexcept {
+			const auto page = m_readPages[ADDRESS().high];
+			if (LIKELY(page != nullptr))
+				DATA() = page[ADDRESS().low];
+			else
+				readMapped();
+		}
+
+		void write() noexcept {
+			const auto page = m_writePages[ADDRESS().high];
+			if (LIKELY(page != nullptr))
+				page[ADDRESS().low] = DATA();
+			else
+				writeMapped();
+		}
+
+		// The host storage behind a page, if the page table resolves it to plain memory
+		[[nodiscard]] constexpr auto readable(const uint8_t page) const noexcept { return m_readPages[page]; }
+		[[nodiscard]] constexpr auto writable(const uint8_t page) const noexcept { return m_writePages[page]; }
+
+		// The page tables themselves, for code generated to index them directly
+		[[nodiscard]] constexpr auto readPages() const noexcept { return m_readPages.data(); }
+		[[nodiscard]] constexpr auto writePages() const noexcept { return m_writePages.data(); }
+
+		// Writes to a watched page bypass the page table, and are announced once made.
+		// Watches are counted, so each "watch" needs a matching "unwatch".
+		Signal<register16_t> WrittenWatchedPage;
+
+		void watch(uint8_t page) noexcept;
+		void unwatch(uint8_t page) noexcept;
+		[[nodiscard]] auto watched(const uint8_t page) const noexcept { return m_watches[page] != 0; }
+
+		// Watchpoints, for debugging.  Reads and/or writes of "begin" to "end" (inclusive)
+		// are reported, with the value before and after, once made.  Only the pages they
+		// touch leave the page table.  Each returns an id, which may be used to remove it.
+		typedef Delegate<WatchpointEventArgs> watcher_t;
+
+		size_t watchpoint(uint16_t begin, uint16_t end, bool reads, bool writes, watcher_t watcher);
+		bool removeWatchpoint(size_t id) noexcept;
+
+		// Memory mapped devices.  A device claims the addresses "begin" to "end" (inclusive),
+		// and every page they touch becomes I/O.  "reading" runs before the mapped memory
+		// is read, so it may refresh it, and "written" runs once it has been written.  The
+		// bus ADDRESS and DATA describe the access.  Accesses to any other page never reach
+		// device code.
+		typedef Delegate<EventArgs> handler_t;
+
+		void attach(uint16_t begin, uint16_t end, handler_t reading, handler_t written);
+
+		// A device that only listens to writes (registers over ROM, say) takes its pages
+		// off the page table for writes alone.  Reads of them stay on it.
+		void attachWriteOnly(uint16_t begin, uint16_t end, handler_t written);
+
+		// The machine wide clock, and anything waiting on it
+		[[nodiscard]] constexpr auto& scheduler() noexcept { return m_scheduler; }
+		[[nodiscard]] constexpr const auto& scheduler() const noexcept { return m_scheduler; }
 
 		virtual void raisePOWER() noexcept;
 		virtual void lowerPOWER() noexcept;
 
 		virtual void initialise() noexcept = 0;
 
+		// Loads into whatever memory is mapped at "address", bypassing any access restrictions
+		void load(uint16_t address, const std::vector<uint8_t>& content);
+
+		// Bytes held by the machine over and above "sizeof": the storage behind its
+		// memory map and anything waiting on its clock.  Boards add whatever else they own.
+		[[nodiscard]] virtual size_t footprint() noexcept;
+
 	protected:
 		[[nodiscard]] uint8_t& reference(uint16_t address) noexcept;
 		[[nodiscard]] uint8_t& reference() noexcept { return reference(ADDRESS().joined); }
 
 		void loadHexFile(const std::string& path);
 
+		// The page table caches host pointers for each 256 byte page that "mapping"
+		// resolves to contiguous memory.  It is empty until a board asks for it, and
+		// must be rebuilt whenever the memory map (or the storage behind it) changes.
+		void remap() noexcept;
+		void unmap() noexcept;
+
+		// I/O pages always use "mapping", even if they resolve to plain memory
+		void markIO(uint8_t page, bool io = true) noexcept { m_ioPages[page] = io; }
+		[[nodiscard]] auto IO(const uint8_t page) const noexcept { return m_ioPages[page]; }
+
 	private:
+		struct device_t final {
+			uint16_t begin = 0;
+			uint16_t end = 0;
+			handler_t reading;
+			handler_t written;
+		};
+
+		struct watchpoint_t final {
+			size_t id = 0;
+			uint16_t begin = 0;
+			uint16_t end = 0;
+			bool reads = false;
+			bool writes = false;
+			watcher_t watcher;
+		};
+
+		void readMapped() noexcept;
+		void writeMapped() noexcept;
+		void remap(uint8_t page) noexcept;
+
+		[[nodiscard]] uint8_t current() noexcept;
+		void hit(bool writing, uint8_t before) noexcept;
+		void rewatch(uint8_t first, uint8_t last) noexcept;
+
+		std::array<const uint8_t*, 0x100> m_readPages = {};
+		std::array<uint8_t*, 0x100> m_writePages = {};
+		std::bitset<0x100> m_ioPages;
+		std::bitset<0x100> m_writeOnlyPages;	// I/O for writes only
+		std::array<uint8_t, 0x100> m_watches = {};
+		std::vector<device_t> m_devices;
+		std::vector<watchpoint_t> m_watchpoints;
+		std::bitset<0x100> m_readWatchpoints;	// Pages
+		std::bitset<0x100> m_writeWatchpoints;
+		size_t m_lastWatchpoint = 0;
+		bool m_paged = false;
+
+		Scheduler m_scheduler;
+
 		uint8_t m_data = Chip::Mask8;
 		register16_t m_address = Chip::Mask16;
 		bool m_writing = false;
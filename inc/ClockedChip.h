@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
+
 #include "Chip.h"
 #include "EventArgs.h"
+#include "Scheduler.h"
 #include "Signal.h"
+#include "EightBitCompilerDefinitions.h"
 
 namespace EightBit {
 	class ClockedChip : public Chip {
@@ -11,25 +16,56 @@ namespace EightBit {
 
 	public:
 		ClockedChip(const ClockedChip& rhs) noexcept;
+		virtual ~ClockedChip() noexcept;
 		bool operator==(const ClockedChip& rhs) const noexcept;
 
+		// Fired for every cycle, but only if connected.  Chips that
+		// are idle most of the time should prefer "advance" instead.
 		Signal<EventArgs> Ticked;
 
 		[[nodiscard]] constexpr auto cycles() const noexcept { return m_cycles; }
 
 		void tick(int extra = 1) noexcept {
 			m_cycles += extra;
-			if (Ticked.active())
-				for (int i = 0; i < extra; ++i)
-					Ticked.fire();
+			if (UNLIKELY(Ticked.attached()))
+				ticked(extra);
 		}
 
+		// Brings a lazily clocked chip up to date, e.g. before it is accessed.
+		// A deadline that hasn't been reached yet stays scheduled.
+		void catchUp() noexcept;
+
 	protected:
+		static constexpr uint64_t Never = std::numeric_limits<uint64_t>::max();
+
 		ClockedChip() noexcept = default;
 
+		// Lazily clocked chips keep time with the machine's scheduler
+		explicit ClockedChip(Scheduler& scheduler) noexcept
+		: m_scheduler(&scheduler) {}
+
 		constexpr void resetCycles() noexcept { m_cycles = 0; }
 
+		// Lazily clocked chips advance their state here, by however many cycles
+		// have elapsed since they were last updated, in one go.
+		virtual void advance(uint64_t) noexcept {}
+
+		// Catch up no later than "cycles" after the last update.  The deadline is
+		// an event on the scheduler, so it is met on an instruction boundary.
+		void schedule(uint64_t cycles);
+		void unschedule() noexcept;
+
+		[[nodiscard]] constexpr auto updated() const noexcept { return m_updated; }
+		[[nodiscard]] constexpr auto deadline() const noexcept { return m_deadline; }
+
 	private:
+		// Kept out of line, so "tick" is cheap enough to inline everywhere
+		void ticked(int extra) noexcept;
+
 		int m_cycles = 0;
+		Scheduler* m_scheduler = nullptr;
+		uint64_t m_updated = 0;
+		uint64_t m_deadline = Never;
+		size_t m_event = 0;
 	};
 }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace EightBit {
+	// Implemented by anything that hands out connections (i.e. Signal)
+	class Connectable {
+	public:
+		virtual ~Connectable() = default;
+
+		virtual void disconnect(size_t id) noexcept = 0;
+		virtual void block(size_t id, bool blocked) noexcept = 0;
+
+		[[nodiscard]] virtual bool connected(size_t id) const noexcept = 0;
+		[[nodiscard]] virtual bool blocked(size_t id) const noexcept = 0;
+	};
+
+	// A handle to a single Signal connection.  Copyable, and does *not*
+	// disconnect when destroyed (see ScopedConnection for that).
+	// Outliving the signal is harmless: the handle just becomes inert.
+	class Connection final {
+	private:
+		std::weak_ptr<Connectable> m_source;
+		size_t m_id = 0;
+
+	public:
+		Connection() noexcept = default;
+		Connection(std::weak_ptr<Connectable> source, const size_t id) noexcept
+		: m_source(std::move(source)),
+		  m_id(id) {}
+
+		[[nodiscard]] auto connected() const noexcept {
+			const auto source = m_source.lock();
+			return source != nullptr && source->connected(m_id);
+		}
+
+		[[nodiscard]] auto blocked() const noexcept {
+			const auto source = m_source.lock();
+			return source != nullptr && source->blocked(m_id);
+		}
+
+		void disconnect() noexcept {
+			if (const auto source = m_source.lock())
+				source->disconnect(m_id);
+			m_source.reset();
+		}
+
+		void block(const bool blocked = true) noexcept {
+			if (const auto source = m_source.lock())
+				source->block(m_id, blocked);
+		}
+
+		void unblock() noexcept { block(false); }
+	};
+
+	// Disconnects when it goes out of scope
+	class ScopedConnection final {
+	private:
+		Connection m_connection;
+
+	public:
+		ScopedConnection() noexcept = default;
+		ScopedConnection(Connection connection) noexcept
+		: m_connection(std::move(connection)) {}
+
+		ScopedConnection(const ScopedConnection&) = delete;
+		ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+		ScopedConnection(ScopedConnection&& rhs) noexcept
+		: m_connection(rhs.release()) {}
+
+		ScopedConnection& operator=(ScopedConnection&& rhs) noexcept {
+			if (this != &rhs) {
+				disconnect();
+				m_connection = rhs.release();
+			}
+			return *this;
+		}
+
+		~ScopedConnection() noexcept { disconnect(); }
+
+		[[nodiscard]] auto connected() const noexcept { return m_connection.connected(); }
+		[[nodiscard]] auto blocked() const noexcept { return m_connection.blocked(); }
+
+		void disconnect() noexcept { m_connection.disconnect(); }
+		void block(const bool blocked = true) noexcept { m_connection.block(blocked); }
+		void unblock() noexcept { m_connection.unblock(); }
+
+		// Gives up ownership, leaving the connection in place
+		[[nodiscard]] Connection release() noexcept { return std::exchange(m_connection, {}); }
+	};
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EightBit {
+	// A "void(T&)" callable wrapper, much like std::function, except that
+	// small callables (lambdas capturing "this", or a couple of references,
+	// std::bind of a member function) are stored inline, without touching
+	// the heap.  Anything larger falls back to a heap allocated copy.
+	template<class T> class Delegate final {
+	public:
+		static constexpr size_t capacity = 4 * sizeof(void*);
+
+		template<class F>
+		static constexpr bool stored_inline =
+			(sizeof(F) <= capacity)
+			&& (alignof(F) <= alignof(std::max_align_t))
+			&& std::is_nothrow_move_constructible_v<F>;
+
+	private:
+		enum class operation_t { Copy, Move, Destroy };
+
+		typedef void (*invoker_t)(void*, T&);
+		typedef void (*manager_t)(operation_t, void* destination, void* source);
+
+		alignas(std::max_align_t) std::byte m_storage[capacity];
+		invoker_t m_invoker = nullptr;
+		manager_t m_manager = nullptr;
+
+		template<class F> [[nodiscard]] static F& target(void* storage) noexcept {
+			if constexpr (stored_inline<F>)
+				return *std::launder(reinterpret_cast<F*>(storage));
+			else
+				return **std::launder(reinterpret_cast<F**>(storage));
+		}
+
+		template<class F> static void invoke(void* storage, T& e) {
+			target<F>(storage)(e);
+		}
+
+		template<class F> static void manage(const operation_t operation, void* destination, void* source) {
+			switch (operation) {
+			case operation_t::Copy:
+				if constexpr (stored_inline<F>)
+					::new (destination) F(target<F>(source));
+				else
+					::new (destination) F*(new F(target<F>(source)));
+				break;
+			case operation_t::Move:
+				if constexpr (stored_inline<F>) {
+					::new (destination) F(std::move(target<F>(source)));
+					target<F>(source).~F();
+				} else {
+					::new (destination) F*(&target<F>(source));
+				}
+				break;
+			case operation_t::Destroy:
+				if constexpr (stored_inline<F>)
+					target<F>(destination).~F();
+				else
+					delete &target<F>(destination);
+				break;
+			}
+		}
+
+		void reset() noexcept {
+			if (m_manager != nullptr)
+				m_manager(operation_t::Destroy, m_storage, nullptr);
+			m_invoker = nullptr;
+			m_manager = nullptr;
+		}
+
+	public:
+		Delegate() noexcept = default;
+
+		template<class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Delegate>>>
+		Delegate(F&& functor) {
+			typedef std::decay_t<F> functor_t;
+			if constexpr (stored_inline<functor_t>)
+				::new (m_storage) functor_t(std::forward<F>(functor));
+			else
+				::new (m_storage) functor_t*(new functor_t(std::forward<F>(functor)));
+			m_invoker = &invoke<functor_t>;
+			m_manager = &manage<functor_t>;
+		}
+
+		Delegate(const Delegate& rhs)
+		: m_invoker(rhs.m_invoker),
+		  m_manager(rhs.m_manager) {
+			if (m_manager != nullptr)
+				m_manager(operation_t::Copy, m_storage, const_cast<std::byte*>(rhs.m_storage));
+		}
+
+		Delegate(Delegate&& rhs) noexcept
+		: m_invoker(rhs.m_invoker),
+		  m_manager(rhs.m_manager) {
+			if (m_manager != nullptr)
+				m_manager(operation_t::Move, m_storage, rhs.m_storage);
+			rhs.m_invoker = nullptr;
+			rhs.m_manager = nullptr;
+		}
+
+		Delegate& operator=(const Delegate& rhs) {
+			if (this != &rhs) {
+				Delegate copy(rhs);
+				*this = std::move(copy);
+			}
+			return *this;
+		}
+
+		Delegate& operator=(Delegate&& rhs) noexcept {
+			if (this != &rhs) {
+				reset();
+				m_invoker = rhs.m_invoker;
+				m_manager = rhs.m_manager;
+				if (m_manager != nullptr)
+					m_manager(operation_t::Move, m_storage, rhs.m_storage);
+				rhs.m_invoker = nullptr;
+				rhs.m_manager = nullptr;
+			}
+			return *this;
+		}
+
+		~Delegate() noexcept { reset(); }
+
+		[[nodiscard]] explicit operator bool() const noexcept { return m_invoker != nullptr; }
+
+		void operator()(T& e) const {
+			m_invoker(const_cast<std::byte*>(m_storage), e);
+		}
+	};
+}
@@ -9,6 +9,14 @@
 	Signal<EventArgs> Lowering ## name; \
 	Signal<EventArgs> Lowered ## name;
 
+// Is anything listening for changes on the pin?
+#define PIN_OBSERVED(name) \
+	(Raising ## name.active() || Raised ## name.active() || Lowering ## name.active() || Lowered ## name.active())
+
+// Cheaper than "PIN_OBSERVED", but only conclusive when false
+#define PIN_ATTACHED(name) \
+	(Raising ## name.attached() || Raised ## name.attached() || Lowering ## name.attached() || Lowered ## name.attached())
+
 #define DECLARE_PIN_LEVEL_RAISE(name) \
 	virtual void raise ## name() noexcept;
 
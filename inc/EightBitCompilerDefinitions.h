@@ -30,3 +30,9 @@
 #	define UNREACHABLE	ASSUME(0)
 
 #endif
+
+// Threaded dispatch needs labels as values ("computed goto"), a GNU extension.
+// Cores that have it use it, unless EIGHTBIT_SWITCH_DISPATCH is defined.
+#if defined(__GNUG__) && !defined(EIGHTBIT_SWITCH_DISPATCH)
+#	define EIGHTBIT_THREADED_DISPATCH
+#endif
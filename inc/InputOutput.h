@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <array>
+#include <memory>
+#include <vector>
 
 #include "Signal.h"
 #include "Register.h"
@@ -10,8 +13,17 @@ namespace EightBit {
 
 	class InputOutput final {
 	private:
-		std::array<uint8_t, 0x10000> _input = {};
-		std::array<uint8_t, 0x10000> _output = {};
+		// Port storage is sparse: nothing is allocated until a port is written,
+		// and then only the 256 port page it lives in.  Unwritten ports read as zero.
+		typedef std::array<uint8_t, 0x100> page_t;
+		typedef std::vector<std::unique_ptr<page_t>> ports_t;
+
+		ports_t _input;
+		ports_t _output;
+
+		[[nodiscard]] static uint8_t peek(const ports_t& ports, register16_t port) noexcept;
+		static void poke(ports_t& ports, register16_t port, uint8_t value);
+		[[nodiscard]] static size_t footprint(const ports_t& ports) noexcept;
 
 	public:
 		Signal<register16_t> ReadingPort;
@@ -27,5 +39,8 @@ namespace EightBit {
 		void write(register16_t port, uint8_t value);
 		void writeOutputPort(register16_t port, uint8_t value);
 		[[nodiscard]] uint8_t readOutputPort(register16_t port);
+
+		// Bytes allocated for port storage
+		[[nodiscard]] size_t footprint() const noexcept { return footprint(_input) + footprint(_output); }
 	};
 }
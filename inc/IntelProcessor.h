@@ -72,6 +72,24 @@ namespace EightBit {
 	protected:
 		IntelProcessor(Bus& bus) noexcept;
 
+		// The sign, zero and parity flags (and the undocumented X and Y flags) of every byte
+		// value, for the flag layout of "T".  Built at compile time, and shared by every instance.
+		[[nodiscard]] static constexpr std::array<uint8_t, 0x100> buildFlags(const int sign, const int zero, const int parity, const int xy) noexcept {
+			std::array<uint8_t, 0x100> flags = {};
+			for (int value = 0; value < 0x100; ++value) {
+				int bits = 0;
+				for (int bit = 0; bit < 8; ++bit)
+					bits += (value >> bit) & 1;
+				flags[value] = static_cast<uint8_t>(((value & Bit7) ? sign : 0) | (value == 0 ? zero : 0) | ((bits % 2) == 0 ? parity : 0) | (value & xy));
+			}
+			return flags;
+		}
+
+		template<class T> static constexpr auto SZ = buildFlags(T::SF, T::ZF, 0, 0);
+		template<class T> static constexpr auto SZP = buildFlags(T::SF, T::ZF, T::PF, 0);
+		template<class T> static constexpr auto SZXY = buildFlags(T::SF, T::ZF, 0, T::XF | T::YF);
+		template<class T> static constexpr auto SZPXY = buildFlags(T::SF, T::ZF, T::PF, T::XF | T::YF);
+
 		template<class T> [[nodiscard]] static constexpr uint8_t adjustSign(uint8_t f, const uint8_t value) noexcept {
 			return setBit(f, T::SF, value & T::SF);
 		}
@@ -81,32 +99,27 @@ namespace EightBit {
 		}
 
 		template<class T> [[nodiscard]] static constexpr uint8_t adjustParity(uint8_t f, const uint8_t value) noexcept {
-			return clearBit(f, T::PF, oddParity(value));
+			return (f & ~T::PF) | (SZP<T>[value] & T::PF);
 		}
 
-		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZ(uint8_t f, const uint8_t value) noexcept {
-			const auto intermediate = adjustSign<T>(f, value);
-			return adjustZero<T>(intermediate, value);
+		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZ(const uint8_t f, const uint8_t value) noexcept {
+			return (f & ~(T::SF | T::ZF)) | SZ<T>[value];
 		}
 
-		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZP(uint8_t f, const uint8_t value) noexcept {
-			const auto intermediate = adjustSZ<T>(f, value);
-			return adjustParity<T>(intermediate, value);
+		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZP(const uint8_t f, const uint8_t value) noexcept {
+			return (f & ~(T::SF | T::ZF | T::PF)) | SZP<T>[value];
 		}
 
-		template<class T> [[nodiscard]] static constexpr uint8_t adjustXY(uint8_t f, const uint8_t value) noexcept {
-			const auto intermediate = setBit(f, T::XF, value & T::XF);
-			return setBit(intermediate, T::YF, value & T::YF);
+		template<class T> [[nodiscard]] static constexpr uint8_t adjustXY(const uint8_t f, const uint8_t value) noexcept {
+			return (f & ~(T::XF | T::YF)) | (value & (T::XF | T::YF));
 		}
 
-		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZPXY(uint8_t f, const uint8_t value) noexcept {
-			const auto intermediate = adjustSZP<T>(f, value);
-			return adjustXY<T>(intermediate, value);
+		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZPXY(const uint8_t f, const uint8_t value) noexcept {
+			return (f & ~(T::SF | T::ZF | T::PF | T::XF | T::YF)) | SZPXY<T>[value];
 		}
 
-		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZXY(uint8_t f, const uint8_t value) noexcept {
-			const auto intermediate = adjustSZ<T>(f, value);
-			return adjustXY<T>(intermediate, value);
+		template<class T> [[nodiscard]] static constexpr uint8_t adjustSZXY(const uint8_t f, const uint8_t value) noexcept {
+			return (f & ~(T::SF | T::ZF | T::XF | T::YF)) | SZXY<T>[value];
 		}
 
 		//
@@ -186,11 +199,20 @@ namespace EightBit {
 		void R(int r, uint8_t value, int ticks = 1) noexcept;
 
 	private:
-		static std::array<int, 8> m_halfCarryTableAdd;
-		static std::array<int, 8> m_halfCarryTableSub;
+		static constexpr std::array<int, 8> m_halfCarryTableAdd = { { 0, 0, 1, 0, 1, 0, 1, 1 } };
+		static constexpr std::array<int, 8> m_halfCarryTableSub = { { 0, 1, 1, 1, 0, 0, 0, 1 } };
+
+		// Shared by every instance (see below)
+		static const std::array<opcode_decoded_t, 0x100> m_decodedOpcodes;
 
-		std::array<opcode_decoded_t, 0x100> m_decodedOpcodes;
 		register16_t m_sp = Mask16;
 		register16_t m_memptr;
 	};
+
+	inline constexpr std::array<IntelProcessor::opcode_decoded_t, 0x100> IntelProcessor::m_decodedOpcodes = [] {
+		std::array<opcode_decoded_t, 0x100> decoded;
+		for (int i = 0; i < 0x100; ++i)
+			decoded[i] = opcode_decoded_t(i);
+		return decoded;
+	}();
 }
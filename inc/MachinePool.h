@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "Scheduler.h"
+
+namespace EightBit {
+
+	// Pins the calling thread to a single core.  False if that isn't supported.
+	bool pinCurrentThread(unsigned core) noexcept;
+
+	// Runs many independent jobs, each on a board of its own, across a pool of
+	// threads.  Boards share nothing, so each job builds one from the factory
+	// (by default, "BoardT(configuration)") on whichever thread picks it up.
+	// Each worker starts with its own run of jobs, and steals from the others
+	// once it has finished them.
+	template<class ConfigurationT, class BoardT, class StateT = std::monostate> class MachinePool final {
+	public:
+		struct job_t {
+			ConfigurationT configuration;
+			std::vector<uint8_t> rom;		// Optional, loaded at "origin" once the board has initialised
+			uint16_t origin = 0;
+			uint64_t budget = 0;			// Guest cycles.  Zero runs until the CPU powers down.
+		};
+
+		struct result_t {
+			StateT state = {};				// From the inspector, once the job has finished
+			uint64_t cycles = 0;
+			std::chrono::steady_clock::duration elapsed = {};
+			bool completed = false;			// Did the CPU power down within budget?
+			unsigned worker = 0;
+			std::exception_ptr error;
+		};
+
+		typedef std::function<std::unique_ptr<BoardT>(const ConfigurationT&)> factory_t;
+		typedef std::function<StateT(BoardT&)> inspector_t;
+
+		MachinePool(factory_t factory = {}, inspector_t inspector = {})
+		: m_factory(factory ? std::move(factory) : defaultFactory),
+		  m_inspector(std::move(inspector)) {}
+
+		[[nodiscard]] constexpr auto& threads() noexcept { return m_threads; }
+		[[nodiscard]] constexpr auto& pinned() noexcept { return m_pinned; }
+
+		[[nodiscard]] auto& jobs() noexcept { return m_jobs; }
+		[[nodiscard]] const auto& results() const noexcept { return m_results; }
+
+		[[nodiscard]] constexpr auto elapsed() const noexcept { return m_elapsed; }
+
+		void add(job_t job) { m_jobs.push_back(std::move(job)); }
+
+		// Results are in the same order as the jobs
+		const std::vector<result_t>& run() {
+
+			m_results.assign(m_jobs.size(), {});
+			const auto count = std::max(1U, std::min<unsigned>(m_threads, static_cast<unsigned>(m_jobs.size())));
+
+			// Contiguous runs of jobs, one per worker
+			m_queues = std::vector<queue_t>(count);
+			for (size_t i = 0; i < m_jobs.size(); ++i)
+				m_queues[i * count / m_jobs.size()].jobs.push_back(i);
+
+			const auto start = std::chrono::steady_clock::now();
+			std::vector<std::thread> workers;
+			workers.reserve(count);
+			for (unsigned worker = 0; worker < count; ++worker)
+				workers.emplace_back([this, worker]() { work(worker); });
+			for (auto& worker : workers)
+				worker.join();
+			m_elapsed = std::chrono::steady_clock::now() - start;
+
+			return m_results;
+		}
+
+	private:
+		struct queue_t {
+			std::mutex lock;
+			std::deque<size_t> jobs;
+		};
+
+		factory_t m_factory;
+		inspector_t m_inspector;
+		unsigned m_threads = std::max(1U, std::thread::hardware_concurrency());
+		bool m_pinned = false;
+
+		std::vector<job_t> m_jobs;
+		std::vector<result_t> m_results;
+		std::vector<queue_t> m_queues;
+		std::chrono::steady_clock::duration m_elapsed = {};
+
+		[[nodiscard]] static std::unique_ptr<BoardT> defaultFactory(const ConfigurationT& configuration) {
+			return std::make_unique<BoardT>(configuration);
+		}
+
+		// Own work from the back, stolen work from the front
+		[[nodiscard]] std::optional<size_t> take(const unsigned worker) {
+			{
+				auto& own = m_queues[worker];
+				std::scoped_lock guard(own.lock);
+				if (!own.jobs.empty()) {
+					const auto job = own.jobs.back();
+					own.jobs.pop_back();
+					return job;
+				}
+			}
+			for (size_t i = 1; i < m_queues.size(); ++i) {
+				auto& victim = m_queues[(worker + i) % m_queues.size()];
+				std::scoped_lock guard(victim.lock);
+				if (!victim.jobs.empty()) {
+					const auto job = victim.jobs.front();
+					victim.jobs.pop_front();
+					return job;
+				}
+			}
+			return {};
+		}
+
+		void work(const unsigned worker) {
+			if (m_pinned)
+				pinCurrentThread(worker);
+			while (const auto job = take(worker)) {
+				auto& result = m_results[*job];
+				result.worker = worker;
+				try {
+					execute(m_jobs[*job], result);
+				} catch (...) {
+					result.error = std::current_exception();
+				}
+			}
+		}
+
+		void execute(const job_t& job, result_t& result) {
+
+			const auto start = std::chrono::steady_clock::now();
+
+			auto board = m_factory(job.configuration);
+			board->initialise();
+			if (!job.rom.empty())
+				board->load(job.origin, job.rom);
+			board->raisePOWER();
+
+			auto& cpu = board->CPU();
+			const auto deadline = job.budget == 0 ? Scheduler::Never : board->scheduler().now() + job.budget;
+			result.cycles = cpu.runUntil(deadline);
+			result.completed = !cpu.powered();
+
+			if (m_inspector)
+				result.state = m_inspector(*board);
+
+			result.elapsed = std::chrono::steady_clock::now() - start;
+		}
+	};
+}
@@ -8,6 +8,6 @@ namespace EightBit {
 	class Mapper {
 	public:
 		virtual ~Mapper() noexcept = default;
-		[[nodiscard]] virtual const MemoryMapping& mapping(uint16_t address) noexcept = 0;
+		[[nodiscard]] virtual MemoryMapping mapping(uint16_t address) noexcept = 0;
 	};
 }
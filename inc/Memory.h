@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <string>
@@ -21,6 +22,13 @@ namespace EightBit {
 
 		[[nodiscard]] virtual uint8_t& reference(uint16_t) noexcept;
 
+		// Direct access to contiguous backing storage, if there is any (nullptr otherwise)
+		[[nodiscard]] virtual uint8_t* data(uint16_t) noexcept { return nullptr; }
+		[[nodiscard]] virtual const uint8_t* data(uint16_t) const noexcept { return nullptr; }
+
+		// Bytes of storage held by this instance, over and above "sizeof"
+		[[nodiscard]] virtual size_t footprint() const noexcept { return 0; }
+
 		virtual int load(std::ifstream& file, int writeOffset = 0, int readOffset = 0, int limit = -1) = 0;
 		virtual int load(std::string path, int writeOffset = 0, int readOffset = 0, int limit = -1) = 0;
 		virtual int load(const std::vector<uint8_t>& bytes, int writeOffset = 0, int readOffset = 0, int limit = -1) = 0;
@@ -1,9 +1,6 @@
 #pragma once
 
 #include <cstdint>
-#include <array>
-#include <limits>
-#include <cassert>
 
 #include "Chip.h"
 
@@ -12,17 +9,7 @@ namespace EightBit {
 	class Memory;
 
 	struct MemoryMapping final {
-	private:
-		static const int minimum = std::numeric_limits<std::uint16_t>::min();
-		static const int maximum = std::numeric_limits<std::uint16_t>::max();
 
-		std::array<uint16_t, maximum + 1> _offsets;
-
-		constexpr auto create_offset(uint16_t address) const noexcept {
-			return (address - begin) & mask;
-		}
-
-	public:
 		enum class AccessLevel { Unknown, ReadOnly, WriteOnly, ReadWrite };
 
 		Memory& memory;
@@ -30,20 +17,14 @@ namespace EightBit {
 		uint16_t mask = 0U;
 		AccessLevel access = AccessLevel::Unknown;
 
-		MemoryMapping(Memory& memory, uint16_t begin, uint16_t mask, AccessLevel access) noexcept
+		constexpr MemoryMapping(Memory& memory, uint16_t begin, uint16_t mask, AccessLevel access) noexcept
 		: memory(memory),
 		  begin(begin),
 		  mask(mask),
-		  access(access) {
-			for (int i = minimum; i < maximum + 1; ++i) {
-				assert(i >= minimum);
-				assert(i <= maximum);
-				_offsets[i] = create_offset(i);
-			}
-		}
+		  access(access) {}
 
-		constexpr auto offset(uint16_t address) const noexcept {
-			return _offsets[address];
+		[[nodiscard]] constexpr uint16_t offset(const uint16_t address) const noexcept {
+			return (address - begin) & mask;
 		}
 	};
 }
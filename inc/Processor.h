@@ -1,9 +1,13 @@
 #pragma once
 
+#include <bitset>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "ClockedChip.h"
 #include "Bus.h"
+#include "Delegate.h"
 #include "Register.h"
 
 #include "EightBitCompilerDefinitions.h"
@@ -14,14 +18,27 @@ namespace EightBit {
 		using base = ClockedChip;
 
 	public:
-		Signal<EventArgs> ExecutingInstruction;
-		Signal<EventArgs> ExecutedInstruction;
-
-		Signal<EventArgs> ReadingMemory;
-		Signal<EventArgs> ReadMemory;
-
-		Signal<EventArgs> WritingMemory;
-		Signal<EventArgs> WrittenMemory;
+		// Boards that never observe them can compile these signals out by defining
+		// EIGHTBIT_ELIDE_INSTRUCTION_SIGNALS and/or EIGHTBIT_ELIDE_MEMORY_SIGNALS.
+#ifdef EIGHTBIT_ELIDE_INSTRUCTION_SIGNALS
+		typedef NullSignal<EventArgs> instruction_signal_t;
+#else
+		typedef Signal<EventArgs> instruction_signal_t;
+#endif
+#ifdef EIGHTBIT_ELIDE_MEMORY_SIGNALS
+		typedef NullSignal<EventArgs> memory_signal_t;
+#else
+		typedef Signal<EventArgs> memory_signal_t;
+#endif
+
+		instruction_signal_t ExecutingInstruction;
+		instruction_signal_t ExecutedInstruction;
+
+		memory_signal_t ReadingMemory;
+		memory_signal_t ReadMemory;
+
+		memory_signal_t WritingMemory;
+		memory_signal_t WrittenMemory;
 
 		// http://graphics.stanford.edu/~seander/bithacks.html#FixedSignExtend
 		// b: number of bits representing the number in x
@@ -43,6 +60,31 @@ namespace EightBit {
 		[[nodiscard]] constexpr const auto& intermediate() const noexcept { return m_intermediate; }
 
 		int run(int limit) noexcept;
+
+		// Runs until the machine clock reaches "deadline", dispatching scheduled
+		// events as they fall due.  Returns the number of cycles actually run.
+		// Idle loops (see "spinning") are skipped over, up to the next event.
+		uint64_t runUntil(uint64_t deadline) noexcept;
+
+		// Traps, for high level emulation (BDOS calls...) and breakpoints.  The handler
+		// runs at the start of any step with PC at its address, before the instruction
+		// there is fetched.  One per address.  The map of trapped addresses is only
+		// allocated by the first trap: until then, a step costs a null test.
+		typedef Delegate<EventArgs> handler_t;
+
+		void trap(uint16_t address, handler_t handler);
+		void untrap(uint16_t address) noexcept;
+		[[nodiscard]] auto trapped(const uint16_t address) const noexcept { return (m_traps != nullptr) && (*m_traps)[address]; }
+		[[nodiscard]] auto trapped(const register16_t address) const noexcept { return trapped(address.joined); }
+		[[nodiscard]] auto trapping() const noexcept { return !m_handlers.empty(); }
+
+		// Bus watchpoints, reported with the PC of the instruction making each access, and
+		// the cycle of the access itself.  Fast modes (6502, Z80) don't count cycles access
+		// by access, so there the cycle is only certain to the instruction: it falls
+		// somewhere between the instruction's first cycle and its last.
+		size_t watchpoint(uint16_t begin, uint16_t end, bool reads, bool writes, Bus::watcher_t watcher);
+		bool removeWatchpoint(size_t id) noexcept;
+
 		virtual int step() noexcept;
 		virtual void poweredStep() noexcept = 0;
 		virtual void execute() noexcept = 0;
@@ -63,6 +105,21 @@ namespace EightBit {
 		virtual void handleRESET() noexcept;
 		virtual void handleINT() noexcept;
 
+		// Asked when a step has left PC where it was.  True if the step will repeat
+		// exactly (HALT, a jump to itself...) until an interrupt or scheduled event
+		// intervenes, and nothing is watching the pins it would have toggled.
+		[[nodiscard]] virtual bool spinning() noexcept { return false; }
+
+		// Accounts for "iterations" further repeats of a spin, without stepping
+		// through them.  The cycles have already been ticked.
+		virtual void spin(uint64_t) noexcept {}
+
+		[[nodiscard]] bool observed() const noexcept;
+
+		// Marks PC as the start of the instruction about to run.  A step does this itself;
+		// paths that run several instructions in one step do it for each of the others.
+		void startInstruction() noexcept { m_instruction = PC(); }
+
 		void memoryWrite(register16_t address, uint8_t data) noexcept;
 		void memoryWrite(register16_t address) noexcept;
 		void memoryWrite(uint8_t data) noexcept;
@@ -118,9 +175,22 @@ namespace EightBit {
 		virtual void ret() noexcept;
 
 	private:
+		struct trap_t final {
+			uint16_t address = 0;
+			handler_t handler;
+		};
+
+		[[nodiscard]] bool quiet(register16_t pc) noexcept;
+		void fastForward(int period, uint64_t until) noexcept;
+		void spring() noexcept;
+
 		Bus& m_bus;
 		uint8_t m_opcode = Mask8;
 		register16_t m_pc;
 		register16_t m_intermediate;
+		register16_t m_instruction;	// PC at the start of the instruction being run
+
+		std::vector<trap_t> m_handlers;
+		std::unique_ptr<std::bitset<0x10000>> m_traps;
 	};
 }
@@ -57,5 +57,9 @@ namespace EightBit {
 		}
 
 		[[nodiscard]] uint8_t peek(uint16_t address) const noexcept final;
+		[[nodiscard]] uint8_t* data(uint16_t address) noexcept final;
+		[[nodiscard]] const uint8_t* data(uint16_t address) const noexcept final;
+
+		[[nodiscard]] size_t footprint() const noexcept final { return BYTES().capacity(); }
 	};
 }
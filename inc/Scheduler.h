@@ -0,0 +1,71 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Delegate.h"
+#include "EventArgs.h"
+#include "EightBitCompilerDefinitions.h"
+
+namespace EightBit {
+	// A machine wide, monotonic cycle clock, with a queue of events due at
+	// future cycles (timer underflow, end of scanline, serial byte complete...)
+	// The processor advances the clock after every instruction, so events
+	// are dispatched on the first instruction boundary at or after their due cycle.
+	class Scheduler final {
+	public:
+		typedef Delegate<EventArgs> handler_t;
+
+		static constexpr uint64_t Never = std::numeric_limits<uint64_t>::max();
+
+		[[nodiscard]] constexpr auto now() const noexcept { return m_now; }
+		[[nodiscard]] constexpr auto next() const noexcept { return m_next; }
+		[[nodiscard]] auto pending() const noexcept { return m_events.size(); }
+		[[nodiscard]] auto footprint() const noexcept { return m_events.capacity() * sizeof(event_t); }
+
+		// Each returns an id, which may be used to cancel the event.
+		size_t at(uint64_t when, handler_t handler);
+		size_t after(const uint64_t cycles, handler_t handler) { return at(m_now + cycles, std::move(handler)); }
+
+		// Repeats every "period" cycles, measured from when it was due, rather than when it was dispatched
+		size_t every(uint64_t period, handler_t handler);
+
+		bool cancel(size_t id) noexcept;
+		void clear() noexcept;
+
+		void elapse(const uint64_t cycles) noexcept {
+			m_now += cycles;
+			if (UNLIKELY(m_now >= m_next))
+				dispatch();
+		}
+
+	private:
+		struct event_t final {
+			uint64_t when = Never;
+			uint64_t period = 0;
+			size_t id = 0;
+			handler_t handler;
+		};
+
+		// A binary heap, earliest first.  Events due on the same cycle are dispatched in the order they were added.
+		std::vector<event_t> m_events;
+		uint64_t m_now = 0;
+		uint64_t m_next = Never;
+		size_t m_last = 0;
+
+		size_t m_dispatching = 0;
+		bool m_cancelled = false;
+
+		[[nodiscard]] static bool later(const event_t& lhs, const event_t& rhs) noexcept;
+
+		void push(event_t event);
+		[[nodiscard]] event_t pop() noexcept;
+		void dispatch() noexcept;
+
+		void updateNext() noexcept { m_next = m_events.empty() ? Never : m_events.front().when; }
+	};
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Memory.h"
+
+namespace EightBit {
+	// A read-only Memory implementation over an image that may be shared
+	// by any number of machines.  The image is loaded once, and
+	// each instance holds nothing more than a reference to it.
+	class SharedRom final : public Memory {
+
+		using base = Memory;
+
+	public:
+		typedef std::shared_ptr<const std::vector<uint8_t>> image_t;
+
+		[[nodiscard]] static image_t image(std::string path);
+		[[nodiscard]] static image_t image(std::vector<uint8_t> bytes);
+
+		SharedRom(image_t image) noexcept;
+
+		[[nodiscard]] constexpr const auto& IMAGE() const noexcept { return m_image; }
+
+		[[nodiscard]] uint16_t size() const noexcept final;
+		[[nodiscard]] uint8_t peek(uint16_t address) const noexcept final;
+		[[nodiscard]] const uint8_t* data(uint16_t address) const noexcept final;
+
+		int load(std::ifstream& file, int writeOffset = 0, int readOffset = 0, int limit = -1) final;
+		int load(std::string path, int writeOffset = 0, int readOffset = 0, int limit = -1) final;
+		int load(const std::vector<uint8_t>& bytes, int writeOffset = 0, int readOffset = 0, int limit = -1) final;
+
+	protected:
+		void poke(uint16_t address, uint8_t value) noexcept final;
+
+	private:
+		image_t m_image;
+	};
+}
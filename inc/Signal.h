@@ -1,31 +1,184 @@
 #pragma once
 
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <vector>
-#include <functional>
+#include <utility>
 
+#include "Connection.h"
+#include "Delegate.h"
 #include "EventArgs.h"
+#include "EightBitCompilerDefinitions.h"
 
 namespace EightBit {
 	template<class T> class Signal final {
 	private:
-		typedef std::function<void(T&)> delegate_t;
-		typedef std::vector<delegate_t> delegates_t;
+		typedef Delegate<T> delegate_t;
 
-		delegates_t m_delegates;
+		struct slot_t final {
+			delegate_t delegate;
+			size_t id = 0;
+			bool connected = true;
+			bool blocked = false;
+		};
+
+		typedef std::vector<slot_t> slots_t;
+
+		// Shared with any outstanding connections, so they can safely outlive the signal.
+		// Whilst firing, the slots are left in place: disconnections are only marked, and
+		// new connections are held back, until the outermost "fire" has completed.
+		class state_t final : public Connectable {
+		private:
+			[[nodiscard]] const slot_t* find(const size_t id) const noexcept {
+				for (const auto* candidates : { &slots, &pending })
+					for (const auto& slot : *candidates)
+						if (slot.id == id)
+							return &slot;
+				return nullptr;
+			}
+
+			[[nodiscard]] slot_t* find(const size_t id) noexcept {
+				return const_cast<slot_t*>(static_cast<const state_t*>(this)->find(id));
+			}
+
+		public:
+			slots_t slots;
+			slots_t pending;
+			size_t last = 0;
+			int depth = 0;
+			bool dirty = false;
+
+			[[nodiscard]] auto firing() const noexcept { return depth > 0; }
+
+			[[nodiscard]] size_t count() const noexcept {
+				const auto connected = [](const slot_t& slot) { return slot.connected; };
+				return std::count_if(slots.cbegin(), slots.cend(), connected) + std::count_if(pending.cbegin(), pending.cend(), connected);
+			}
+
+			template<class F> size_t add(F&& functor) {
+				const auto id = ++last;
+				(firing() ? pending : slots).push_back({ delegate_t(std::forward<F>(functor)), id });
+				return id;
+			}
+
+			void settle() {
+				assert(!firing());
+				std::move(pending.begin(), pending.end(), std::back_inserter(slots));
+				pending.clear();
+				if (dirty) {
+					slots.erase(std::remove_if(slots.begin(), slots.end(), [](const slot_t& slot) { return !slot.connected; }), slots.end());
+					dirty = false;
+				}
+			}
+
+			void disconnect(const size_t id) noexcept final {
+				auto* const slot = find(id);
+				if (slot == nullptr)
+					return;
+				slot->connected = false;
+				dirty = true;
+				if (!firing())
+					settle();
+			}
+
+			void block(const size_t id, const bool blocked) noexcept final {
+				if (auto* const slot = find(id))
+					slot->blocked = blocked;
+			}
+
+			[[nodiscard]] bool connected(const size_t id) const noexcept final {
+				const auto* const slot = find(id);
+				return slot != nullptr && slot->connected;
+			}
+
+			[[nodiscard]] bool blocked(const size_t id) const noexcept final {
+				const auto* const slot = find(id);
+				return slot != nullptr && slot->connected && slot->blocked;
+			}
+		};
+
+		// Only allocated once something connects, and dropped again once
+		// everything has disconnected, so an unobserved signal costs one test.
+		mutable std::shared_ptr<state_t> m_state;
+
+		void fireAll(T& e) const noexcept {
+			auto& state = *m_state;
+			++state.depth;
+			const auto count = state.slots.size();
+			for (size_t i = 0; i < count; ++i) {
+				const auto& slot = state.slots[i];
+				if (slot.connected && !slot.blocked)
+					slot.delegate(e);
+			}
+			if (--state.depth == 0) {
+				state.settle();
+				if (state.slots.empty())
+					m_state.reset();
+			}
+		}
 
 	public:
-		[[nodiscard]] constexpr auto count() const noexcept { return m_delegates.size(); }
-		[[nodiscard]] constexpr auto inactive() const noexcept { return count() == 0; }
-		[[nodiscard]] constexpr auto singular() const noexcept { return count() == 1; }
-		[[nodiscard]] constexpr auto active() const noexcept { return count() != 0; }
+		Signal() noexcept = default;
+
+		// A copy gets its own copies of the connected delegates, but
+		// existing connection handles continue to refer to the original.
+		Signal(const Signal& rhs) {
+			if (rhs.m_state == nullptr)
+				return;
+			for (const auto* candidates : { &rhs.m_state->slots, &rhs.m_state->pending })
+				for (const auto& slot : *candidates)
+					if (slot.connected)
+						connect(slot.delegate);
+		}
+
+		Signal(Signal&&) noexcept = default;
 
-		constexpr void connect(const delegate_t functor) {
-			m_delegates.push_back(functor);
+		Signal& operator=(const Signal& rhs) {
+			if (this != &rhs) {
+				Signal copy(rhs);
+				m_state = std::move(copy.m_state);
+			}
+			return *this;
+		}
+
+		Signal& operator=(Signal&&) noexcept = default;
+
+		[[nodiscard]] auto count() const noexcept { return m_state == nullptr ? 0 : m_state->count(); }
+		[[nodiscard]] auto inactive() const noexcept { return count() == 0; }
+		[[nodiscard]] auto singular() const noexcept { return count() == 1; }
+		[[nodiscard]] auto active() const noexcept { return count() != 0; }
+
+		// Cheaper than "active", but only conclusive when false: a signal may stay
+		// attached after its last disconnection, until it next fires.
+		[[nodiscard]] auto attached() const noexcept { return m_state != nullptr; }
+
+		// The returned handle may be ignored, in which case the connection is permanent.
+		// Keep it (or a ScopedConnection made from it) to block or disconnect later.
+		template<class F> Connection connect(F&& functor) {
+			if (m_state == nullptr)
+				m_state = std::make_shared<state_t>();
+			const auto id = m_state->add(std::forward<F>(functor));
+			return { m_state, id };
 		}
 
 		void fire(T& e = EventArgs::empty()) const noexcept {
-			for (auto& delegate : m_delegates)
-				delegate(e);
+			if (UNLIKELY(m_state != nullptr))
+				fireAll(e);
 		}
 	};
+
+	// Stands in for a Signal that has been compiled out: it can be fired
+	// (to no effect), but not connected to.
+	template<class T> class NullSignal final {
+	public:
+		[[nodiscard]] static constexpr size_t count() noexcept { return 0; }
+		[[nodiscard]] static constexpr auto inactive() noexcept { return true; }
+		[[nodiscard]] static constexpr auto singular() noexcept { return false; }
+		[[nodiscard]] static constexpr auto active() noexcept { return false; }
+		[[nodiscard]] static constexpr auto attached() noexcept { return false; }
+
+		static constexpr void fire(T& = EventArgs::empty()) noexcept {}
+	};
 }
@@ -1,9 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <chrono>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include "MachinePool.h"
+#include "Signal.h"
 #include "EightBitCompilerDefinitions.h"
 
 #ifdef _MSC_VER
@@ -17,70 +27,148 @@
 namespace EightBit {
 	template<class ConfigurationT, class BoardT> class TestHarness final {
 	public:
+		enum class format_t { Text, Json, Csv };
+
+		// Signals given an empty handler on each measured board, to show what observing costs
+		enum class observe_t { None, Instructions, Memory, All };
+
+		struct options_t {
+			unsigned warmups = 0;
+			unsigned runs = 0;				// Measured runs.  Zero is a single run, reported as it always has been
+			uint64_t budget = 0;			// Guest cycles.  Zero runs until the CPU powers down
+			std::optional<unsigned> core;	// Pinned to this core, if set
+			format_t format = format_t::Text;
+			observe_t observe = observe_t::None;
+			std::string output;				// Benchmark report file, standard output if empty
+		};
+
+		struct statistics_t {
+			double min = 0.0;
+			double median = 0.0;
+			double p95 = 0.0;
+		};
+
 		TestHarness(const ConfigurationT& configuration) noexcept
-		: m_board(configuration) {}
+		: m_configuration(configuration),
+		  m_board(configuration) {}
 
 		~TestHarness() {
+			if (m_sample.instructions == 0)
+				return;
+
+			if (benchmarking()) {
+				report();
+				return;
+			}
+
 			std::cout << std::dec << std::endl;
 			std::cout.imbue(std::locale(""));
 
-			std::cout << "Guest cycles = " << m_totalCycles << std::endl;
+			std::cout << "Guest cycles = " << m_sample.cycles << std::endl;
 			std::cout << "Seconds = " << getElapsedSeconds() << std::endl;
 
 			std::cout << getCyclesPerSecond() / 1'000'000 << " MHz" << std::endl;
 			std::cout << getInstructionsPerSecond() << " instructions per second" << std::endl;
 
-			auto elapsedHostCycles = m_finishHostCycles - m_startHostCycles;
-			std::cout << "Host cycles = " << elapsedHostCycles << std::endl;
+			std::cout << "Host cycles = " << m_sample.hostCycles << std::endl;
 
-			auto efficiency = elapsedHostCycles / m_totalCycles;
+			auto efficiency = m_sample.hostCycles / m_sample.cycles;
 			std::cout << "Efficiency = " << efficiency << std::endl;
+
+			std::cout << "Footprint = " << getFootprint() << " bytes" << std::endl;
+		}
+
+		[[nodiscard]] constexpr auto& options() noexcept { return m_options; }
+		[[nodiscard]] constexpr auto benchmarking() const noexcept { return m_options.runs > 0; }
+
+		// --warmup N --runs N --budget CYCLES --pin CORE --format text|json|csv --output PATH
+		// --observe none|instructions|memory|all
+		[[nodiscard]] bool parse(const int argc, char* argv[]) {
+			for (int i = 1; i < argc; i += 2) {
+				const std::string option = argv[i];
+				if (i + 1 == argc)
+					return usage(option);
+				const std::string value = argv[i + 1];
+				try {
+					if (option == "--warmup")
+						m_options.warmups = std::stoul(value);
+					else if (option == "--runs")
+						m_options.runs = std::stoul(value);
+					else if (option == "--budget")
+						m_options.budget = std::stoull(value);
+					else if (option == "--pin")
+						m_options.core = std::stoul(value);
+					else if (option == "--output")
+						m_options.output = value;
+					else if (option == "--format" && value == "text")
+						m_options.format = format_t::Text;
+					else if (option == "--format" && value == "json")
+						m_options.format = format_t::Json;
+					else if (option == "--format" && value == "csv")
+						m_options.format = format_t::Csv;
+					else if (option == "--observe" && value == "none")
+						m_options.observe = observe_t::None;
+					else if (option == "--observe" && value == "instructions")
+						m_options.observe = observe_t::Instructions;
+					else if (option == "--observe" && value == "memory")
+						m_options.observe = observe_t::Memory;
+					else if (option == "--observe" && value == "all")
+						m_options.observe = observe_t::All;
+					else
+						return usage(option);
+				} catch (const std::logic_error&) {
+					return usage(option);
+				}
+			}
+			return true;
 		}
 
 		[[nodiscard]] std::chrono::steady_clock::duration getElapsedTime() const {
-			return m_finishTime - m_startTime;
+			return m_sample.elapsed;
 		}
 
 		[[nodiscard]] auto getElapsedSeconds() const {
-			return std::chrono::duration_cast<std::chrono::duration<double>>(getElapsedTime()).count();
+			return m_sample.seconds();
 		}
 
 		[[nodiscard]] auto getCyclesPerSecond() const {
-			return m_totalCycles / getElapsedSeconds();
+			return m_sample.cycles / getElapsedSeconds();
 		}
 
 		[[nodiscard]] auto getInstructionsPerSecond() {
-			auto floating = m_instructions / getElapsedSeconds();
+			auto floating = m_sample.instructions / getElapsedSeconds();
 			return (long long)floating;
 		}
 
-		void run() noexcept {
-			m_startTime = now();
-			m_totalCycles = m_instructions = 0L;
-			m_startHostCycles = currentHostCycles();
+		// Everything a single machine holds: the board itself, and the storage it owns
+		[[nodiscard]] auto getFootprint() {
+			return sizeof(BoardT) + m_board.footprint();
+		}
 
-			m_board.initialise();
-			m_board.raisePOWER();
+		void run() {
+			if (benchmarking())
+				benchmark();
+			else
+				m_sample = measure(m_board);
+		}
 
-			auto& cpu = m_board.CPU();
+	private:
+		struct sample_t {
+			long long cycles = 0;
+			long long instructions = 0;
+			uint64_t hostCycles = 0;
+			std::chrono::steady_clock::duration elapsed = {};
 
-			while (LIKELY(cpu.powered())) {
-				m_totalCycles += cpu.step();
-				++m_instructions;
+			[[nodiscard]] auto seconds() const {
+				return std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
 			}
+		};
 
-			m_finishHostCycles = currentHostCycles();
-			m_finishTime = now();
-		}
-
-	private:
+		const ConfigurationT& m_configuration;
 		BoardT m_board;
-		long long m_totalCycles = 0;
-		long long m_instructions = 0;
-		std::chrono::steady_clock::time_point m_startTime;
-		std::chrono::steady_clock::time_point m_finishTime;
-		uint64_t m_startHostCycles = 0;
-		uint64_t m_finishHostCycles = 0;
+		options_t m_options;
+		sample_t m_sample;
+		std::vector<sample_t> m_samples;
 
 		[[nodiscard]] static auto now() {
 			return std::chrono::steady_clock::now();
@@ -89,5 +177,126 @@ namespace EightBit {
 		[[nodiscard]] static uint64_t currentHostCycles() {
 			return __rdtsc();
 		}
+
+		[[nodiscard]] static bool usage(const std::string& option) {
+			std::cerr
+				<< "Unrecognised option: " << option << std::endl
+				<< "Options: --warmup N --runs N --budget CYCLES --pin CORE --format text|json|csv --output PATH --observe none|instructions|memory|all" << std::endl;
+			return false;
+		}
+
+		[[nodiscard]] sample_t measure(BoardT& board) const noexcept {
+
+			const long long budget = m_options.budget == 0 ? std::numeric_limits<long long>::max() : m_options.budget;
+
+			sample_t sample;
+			const auto start = now();
+			const auto startHostCycles = currentHostCycles();
+
+			board.initialise();
+			board.raisePOWER();
+
+			auto& cpu = board.CPU();
+			observe(cpu);
+
+			while (LIKELY(cpu.powered()) && LIKELY(sample.cycles < budget)) {
+				sample.cycles += cpu.step();
+				++sample.instructions;
+			}
+
+			sample.hostCycles = currentHostCycles() - startHostCycles;
+			sample.elapsed = now() - start;
+			return sample;
+		}
+
+		template<class T> static void observe(Signal<T>& signal) {
+			signal.connect([](T&) {});
+		}
+
+		template<class T> static void observe(NullSignal<T>&) noexcept {}
+
+		template<class ProcessorT> void observe(ProcessorT& cpu) const {
+			if ((m_options.observe == observe_t::Instructions) || (m_options.observe == observe_t::All)) {
+				observe(cpu.ExecutingInstruction);
+				observe(cpu.ExecutedInstruction);
+			}
+			if ((m_options.observe == observe_t::Memory) || (m_options.observe == observe_t::All)) {
+				observe(cpu.ReadingMemory);
+				observe(cpu.ReadMemory);
+				observe(cpu.WritingMemory);
+				observe(cpu.WrittenMemory);
+			}
+		}
+
+		// Every run is on a board of its own, so each starts from the same state
+		void benchmark() {
+			if (m_options.core.has_value() && !pinCurrentThread(*m_options.core))
+				std::cerr << "Unable to pin to core " << *m_options.core << std::endl;
+			for (unsigned i = 0; i < m_options.warmups; ++i)
+				(void)measure(*std::make_unique<BoardT>(m_configuration));
+			m_samples.clear();
+			for (unsigned i = 0; i < m_options.runs; ++i)
+				m_samples.push_back(measure(*std::make_unique<BoardT>(m_configuration)));
+			m_sample = m_samples.back();
+		}
+
+		template<class F> [[nodiscard]] statistics_t statistics(F metric) const {
+			std::vector<double> values;
+			for (const auto& sample : m_samples)
+				values.push_back(metric(sample));
+			std::sort(values.begin(), values.end());
+			const auto count = values.size();
+			const auto median = count % 2 == 1 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+			const auto rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(0.95 * count)));
+			return { values.front(), median, values[rank - 1] };
+		}
+
+		// Efficiency is host cycles per guest cycle
+		void report() {
+			const auto seconds = statistics([](const sample_t& sample) { return sample.seconds(); });
+			const auto mhz = statistics([](const sample_t& sample) { return sample.cycles / sample.seconds() / 1'000'000; });
+			const auto efficiency = statistics([](const sample_t& sample) { return double(sample.hostCycles) / sample.cycles; });
+
+			std::ofstream file;
+			if (!m_options.output.empty())
+				file.open(m_options.output);
+			auto& output = m_options.output.empty() ? std::cout : file;
+			output.imbue(std::locale::classic());
+			output << std::dec;
+
+			switch (m_options.format) {
+			case format_t::Json:
+				output
+					<< "{ \"runs\": " << m_samples.size()
+					<< ", \"warmups\": " << m_options.warmups
+					<< ", \"budget\": " << m_options.budget
+					<< ", \"cycles\": " << m_sample.cycles
+					<< ", \"instructions\": " << m_sample.instructions
+					<< ", \"footprint\": " << getFootprint();
+				for (const auto& [name, statistic] : { std::pair{ "seconds", seconds }, std::pair{ "mhz", mhz }, std::pair{ "efficiency", efficiency } })
+					output
+						<< ", \"" << name << "\": { \"min\": " << statistic.min
+						<< ", \"median\": " << statistic.median
+						<< ", \"p95\": " << statistic.p95 << " }";
+				output << " }" << std::endl;
+				break;
+			case format_t::Csv:
+				output << "metric,min,median,p95" << std::endl;
+				for (const auto& [name, statistic] : { std::pair{ "seconds", seconds }, std::pair{ "mhz", mhz }, std::pair{ "efficiency", efficiency } })
+					output << name << "," << statistic.min << "," << statistic.median << "," << statistic.p95 << std::endl;
+				break;
+			case format_t::Text:
+				output
+					<< std::endl
+					<< "Runs = " << m_samples.size() << " (after " << m_options.warmups << " warm-up)" << std::endl
+					<< "Guest cycles = " << m_sample.cycles << std::endl
+					<< "Instructions = " << m_sample.instructions << std::endl
+					<< "Footprint = " << getFootprint() << " bytes" << std::endl
+					<< "\tmin\tmedian\tp95" << std::endl;
+				for (const auto& [name, statistic] : { std::pair{ "Seconds", seconds }, std::pair{ "MHz", mhz }, std::pair{ "Efficiency", efficiency } })
+					output << name << "\t" << statistic.min << "\t" << statistic.median << "\t" << statistic.p95 << std::endl;
+				break;
+			}
+		}
 	};
 }
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#include "EventArgs.h"
+#include "Register.h"
+
+namespace EightBit {
+	class WatchpointEventArgs final : public EventArgs {
+
+		using base = EventArgs;
+
+	private:
+		register16_t _address;
+		uint8_t _before;
+		uint8_t _after;
+		bool _writing;
+		uint64_t _cycle;
+		register16_t _pc;
+
+	public:
+		WatchpointEventArgs(register16_t address, uint8_t before, uint8_t after, bool writing, uint64_t cycle, register16_t pc = 0) noexcept
+		: _address(address),
+		  _before(before),
+		  _after(after),
+		  _writing(writing),
+		  _cycle(cycle),
+		  _pc(pc) {}
+
+		[[nodiscard]] constexpr auto address() const noexcept { return _address; }
+		[[nodiscard]] constexpr auto before() const noexcept { return _before; }
+		[[nodiscard]] constexpr auto after() const noexcept { return _after; }
+		[[nodiscard]] constexpr auto writing() const noexcept { return _writing; }
+		[[nodiscard]] constexpr auto reading() const noexcept { return !writing(); }
+		[[nodiscard]] constexpr auto cycle() const noexcept { return _cycle; }
+		[[nodiscard]] constexpr auto pc() const noexcept { return _pc; }
+	};
+}
@@ -8,16 +8,135 @@ void EightBit::Bus::raisePOWER() noexcept {}
 
 void EightBit::Bus::lowerPOWER() noexcept {}
 
-void EightBit::Bus::read() noexcept {
+void EightBit::Bus::readMapped() noexcept {
+	if (UNLIKELY(IO(ADDRESS().high))) {
+		const auto address = ADDRESS().joined;
+		for (const auto& device : m_devices) {
+			if ((address >= device.begin) && (address <= device.end) && device.reading)
+				device.reading(EventArgs::empty());
+		}
+	}
 	DATA() = reference();
+	if (UNLIKELY(m_readWatchpoints[ADDRESS().high]))
+		hit(false, DATA());
 }
 
-void EightBit::Bus::write() noexcept {
+void EightBit::Bus::writeMapped() noexcept {
+	const bool watching = m_writeWatchpoints[ADDRESS().high];
+	const auto before = UNLIKELY(watching) ? current() : DATA();
 	assert(!m_writing);
 	m_writing = true;
 	reference() = DATA();
 	m_writing = false;
 	assert(!m_writing);
+	if (UNLIKELY(watching))
+		hit(true, before);
+	if (UNLIKELY(IO(ADDRESS().high) || m_writeOnlyPages[ADDRESS().high])) {
+		const auto address = ADDRESS().joined;
+		for (const auto& device : m_devices) {
+			if ((address >= device.begin) && (address <= device.end) && device.written)
+				device.written(EventArgs::empty());
+		}
+	}
+	if (UNLIKELY(watched(ADDRESS().high))) {
+		auto address = ADDRESS();
+		WrittenWatchedPage.fire(address);
+	}
+}
+
+void EightBit::Bus::attach(const uint16_t begin, const uint16_t end, handler_t reading, handler_t written) {
+	assert(begin <= end);
+	m_devices.push_back({ begin, end, std::move(reading), std::move(written) });
+	for (int page = begin >> 8; page <= (end >> 8); ++page) {
+		markIO(page);
+		remap(page);
+	}
+}
+
+void EightBit::Bus::attachWriteOnly(const uint16_t begin, const uint16_t end, handler_t written) {
+	assert(begin <= end);
+	m_devices.push_back({ begin, end, {}, std::move(written) });
+	for (int page = begin >> 8; page <= (end >> 8); ++page) {
+		m_writeOnlyPages[page] = true;
+		m_writePages[page] = nullptr;
+	}
+}
+
+void EightBit::Bus::watch(const uint8_t page) noexcept {
+	++m_watches[page];
+	m_writePages[page] = nullptr;
+}
+
+void EightBit::Bus::unwatch(const uint8_t page) noexcept {
+	assert(watched(page));
+	if ((--m_watches[page] == 0) && m_paged)
+		remap(page);
+}
+
+size_t EightBit::Bus::watchpoint(const uint16_t begin, const uint16_t end, const bool reads, const bool writes, watcher_t watcher) {
+	assert(begin <= end);
+	const auto id = ++m_lastWatchpoint;
+	m_watchpoints.push_back({ id, begin, end, reads, writes, std::move(watcher) });
+	const register16_t first = begin, last = end;
+	if (writes) {
+		for (int page = first.high; page <= last.high; ++page)
+			watch(page);
+	}
+	rewatch(first.high, last.high);
+	return id;
+}
+
+bool EightBit::Bus::removeWatchpoint(const size_t id) noexcept {
+	const auto found = std::find_if(m_watchpoints.begin(), m_watchpoints.end(), [id](const watchpoint_t& watchpoint) { return watchpoint.id == id; });
+	if (found == m_watchpoints.end())
+		return false;
+	const register16_t first = found->begin, last = found->end;
+	const auto writes = found->writes;
+	m_watchpoints.erase(found);
+	rewatch(first.high, last.high);
+	if (writes) {
+		for (int page = first.high; page <= last.high; ++page)
+			unwatch(page);
+	}
+	return true;
+}
+
+// Recalculates the watched state of a run of pages, taking read watched pages off the page table
+void EightBit::Bus::rewatch(const uint8_t first, const uint8_t last) noexcept {
+	for (int page = first; page <= last; ++page) {
+		bool reads = false, writes = false;
+		for (const auto& watchpoint : m_watchpoints) {
+			if (((watchpoint.begin >> 8) <= page) && (page <= (watchpoint.end >> 8))) {
+				reads = reads || watchpoint.reads;
+				writes = writes || watchpoint.writes;
+			}
+		}
+		m_writeWatchpoints[page] = writes;
+		if (reads == m_readWatchpoints[page])
+			continue;
+		m_readWatchpoints[page] = reads;
+		if (reads)
+			m_readPages[page] = nullptr;
+		else if (m_paged)
+			remap(page);
+	}
+}
+
+uint8_t EightBit::Bus::current() noexcept {
+	const auto address = ADDRESS().joined;
+	const auto mapped = mapping(address);
+	return mapped.memory.peek(mapped.offset(address));
+}
+
+// Watchers mustn't add or remove watchpoints
+void EightBit::Bus::hit(const bool writing, const uint8_t before) noexcept {
+	const auto address = ADDRESS().joined;
+	for (const auto& watchpoint : m_watchpoints) {
+		if ((writing ? watchpoint.writes : watchpoint.reads) && (address >= watchpoint.begin) && (address <= watchpoint.end)) {
+			WatchpointEventArgs e(ADDRESS(), before, DATA(), writing, scheduler().now());
+			watchpoint.watcher(e);
+		}
+	}
 }
 
 void EightBit::Bus::loadHexFile(const std::string& path) {
@@ -25,14 +144,74 @@ void EightBit::Bus::loadHexFile(const std::string& path) {
 	const auto chunks = file.parse();
 	for (const auto& chunk : chunks) {
 		const auto& [address, content] = chunk;
-		const auto mapped = mapping(address);
-		const uint16_t offset = address - mapped.begin;
-		mapped.memory.load(content, offset);
+		load(address, content);
+	}
+}
+
+void EightBit::Bus::load(const uint16_t address, const std::vector<uint8_t>& content) {
+	const auto mapped = mapping(address);
+	const uint16_t offset = address - mapped.begin;
+	mapped.memory.load(content, offset);
+}
+
+void EightBit::Bus::unmap() noexcept {
+	m_readPages.fill(nullptr);
+	m_writePages.fill(nullptr);
+	m_paged = false;
+}
+
+void EightBit::Bus::remap() noexcept {
+	m_paged = true;
+	for (int page = 0; page < 0x100; ++page)
+		remap(page);
+}
+
+void EightBit::Bus::remap(const uint8_t page) noexcept {
+
+	m_readPages[page] = m_writePages[page] = nullptr;
+	if (IO(page))
+		return;
+
+	const register16_t start = { 0, page };
+	const auto mapped = mapping(start.joined);
+	auto& memory = mapped.memory;
+	const auto access = mapped.access;
+	const auto offset = mapped.offset(start.joined);
+
+	// Every address in the page must resolve to the same, contiguous, storage
+	for (int i = 0; i < 0x100; ++i) {
+		const uint16_t address = start.joined + i;
+		const auto candidate = mapping(address);
+		if ((&candidate.memory != &memory) || (candidate.access != access) || (candidate.offset(address) != (offset + i)))
+			return;
+	}
+
+	const auto* const host = std::as_const(memory).data(offset);
+	if ((host == nullptr) || (std::as_const(memory).data(offset + 0xff) != host + 0xff))
+		return;
+
+	if (!m_readWatchpoints[page])
+		m_readPages[page] = host;
+	if ((access != MemoryMapping::AccessLevel::ReadOnly) && !watched(page) && !m_writeOnlyPages[page])
+		m_writePages[page] = memory.data(offset);
+}
+
+size_t EightBit::Bus::footprint() noexcept {
+	auto bytes = scheduler().footprint() + m_devices.capacity() * sizeof(device_t) + m_watchpoints.capacity() * sizeof(watchpoint_t);
+	std::vector<const Memory*> counted;
+	for (int page = 0; page < 0x100; ++page) {
+		const register16_t start = { 0, (uint8_t)page };
+		const auto* const memory = &mapping(start.joined).memory;
+		if (std::find(counted.cbegin(), counted.cend(), memory) == counted.cend()) {
+			counted.push_back(memory);
+			bytes += memory->footprint();
+		}
 	}
+	return bytes;
 }
 
 uint8_t& EightBit::Bus::reference(const uint16_t address) noexcept {
-	const auto& mapped = mapping(address);
+	const auto mapped = mapping(address);
 	const auto offset = mapped.offset(address);
 	if (mapped.access != MemoryMapping::AccessLevel::ReadOnly)
 		return mapped.memory.reference(offset);
@@ -4,6 +4,14 @@
 EightBit::ClockedChip::ClockedChip(const ClockedChip& rhs) noexcept
 : base(rhs) {
 	m_cycles = rhs.m_cycles;
+	m_scheduler = rhs.m_scheduler;
+	m_updated = rhs.m_updated;
+	if (rhs.m_deadline != Never)
+		schedule(rhs.m_deadline - m_updated);
+}
+
+EightBit::ClockedChip::~ClockedChip() noexcept {
+	unschedule();
 }
 
 bool EightBit::ClockedChip::operator==(const EightBit::ClockedChip& rhs) const noexcept {
@@ -11,3 +19,41 @@ bool EightBit::ClockedChip::operator==(const EightBit::ClockedChip& rhs) const n
 		base::operator==(rhs)
 		&& cycles() == rhs.cycles();
 }
+
+void EightBit::ClockedChip::ticked(const int extra) noexcept {
+	if (Ticked.active())
+		for (int i = 0; i < extra; ++i)
+			Ticked.fire();
+}
+
+void EightBit::ClockedChip::catchUp() noexcept {
+	if (m_scheduler == nullptr)
+		return;
+	const auto now = m_scheduler->now();
+	if (now >= m_deadline)
+		unschedule();
+	const auto elapsed = now - m_updated;
+	m_updated = now;
+	if (elapsed > 0)
+		advance(elapsed);
+}
+
+void EightBit::ClockedChip::schedule(const uint64_t cycles) {
+	assert(m_scheduler != nullptr);
+	const auto deadline = m_updated + cycles;
+	if (deadline >= m_deadline)
+		return;
+	unschedule();
+	m_deadline = deadline;
+	m_event = m_scheduler->at(deadline, [this](EventArgs&) {
+		m_event = 0;
+		catchUp();
+	});
+}
+
+void EightBit::ClockedChip::unschedule() noexcept {
+	if (m_event != 0)
+		m_scheduler->cancel(m_event);
+	m_event = 0;
+	m_deadline = Never;
+}
@@ -3,6 +3,29 @@
 
 namespace EightBit {
 
+// Sparse port storage
+
+uint8_t InputOutput::peek(const ports_t& ports, const register16_t port) noexcept {
+	if (ports.empty())
+		return 0;
+	const auto& page = ports[port.high];
+	return page == nullptr ? 0 : (*page)[port.low];
+}
+
+void InputOutput::poke(ports_t& ports, const register16_t port, const uint8_t value) {
+	if (ports.empty())
+		ports.resize(0x100);
+	auto& page = ports[port.high];
+	if (page == nullptr)
+		page = std::make_unique<page_t>();
+	(*page)[port.low] = value;
+}
+
+size_t InputOutput::footprint(const ports_t& ports) noexcept {
+	const auto allocated = std::count_if(ports.cbegin(), ports.cend(), [](const auto& page) { return page != nullptr; });
+	return ports.capacity() * sizeof(ports_t::value_type) + allocated * sizeof(page_t);
+}
+
 // Input port actions
 
 uint8_t InputOutput::read(register16_t port) {
@@ -11,13 +34,13 @@ uint8_t InputOutput::read(register16_t port) {
 
 uint8_t InputOutput::readInputPort(register16_t port) {
 	ReadingPort.fire(port);
-	const auto value = _input[port.joined];
+	const auto value = peek(_input, port);
 	ReadPort.fire(port);
 	return value;
 }
 
 void InputOutput::writeInputPort(register16_t port, uint8_t value) {
-	_input[port.joined] = value;
+	poke(_input, port, value);
 }
 
 // Output port actions
@@ -28,12 +51,12 @@ void InputOutput::write(register16_t port, uint8_t value) {
 
 void InputOutput::writeOutputPort(register16_t port, uint8_t value) {
 	WritingPort.fire(port);
-	_output[port.joined] = value;
+	poke(_output, port, value);
 	WrittenPort.fire(port);
 }
 
 uint8_t InputOutput::readOutputPort(register16_t port) {
-	return _output[port.joined];
+	return peek(_output, port);
 }
 
 }
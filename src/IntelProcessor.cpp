@@ -1,14 +1,8 @@
 #include "stdafx.h"
 #include "../inc/IntelProcessor.h"
 
-std::array<int, 8> EightBit::IntelProcessor::m_halfCarryTableAdd = { { 0, 0, 1, 0, 1, 0, 1, 1 } };
-std::array<int, 8> EightBit::IntelProcessor::m_halfCarryTableSub = { { 0, 1, 1, 1, 0, 0, 0, 1 } };
-
 EightBit::IntelProcessor::IntelProcessor(Bus& bus) noexcept
 : base(bus) {
-	for (int i = 0; i < 0x100; ++i)
-		m_decodedOpcodes.at(i) = i;
-
 	RaisedPOWER.connect([this](EventArgs) {
 		PC() = SP() = Mask16;
 		resetRegisterSet();
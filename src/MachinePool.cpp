@@ -0,0 +1,26 @@
+#include "stdafx.h"
+#include "../inc/MachinePool.h"
+
+#if defined(_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(__linux__)
+#	include <pthread.h>
+#	include <sched.h>
+#endif
+
+bool EightBit::pinCurrentThread(const unsigned core) noexcept {
+#if defined(_WIN32)
+	const auto mask = DWORD_PTR(1) << (core % (8 * sizeof(DWORD_PTR)));
+	return ::SetThreadAffinityMask(::GetCurrentThread(), mask) != 0;
+#elif defined(__linux__)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(core % CPU_SETSIZE, &cpus);
+	return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+	(void)core;
+	return false;
+#endif
+}
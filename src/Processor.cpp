@@ -10,7 +10,8 @@ EightBit::Processor::Processor(const Processor& rhs) noexcept
   m_bus(rhs.m_bus),
   m_opcode(rhs.m_opcode),
   m_pc(rhs.m_pc),
-  m_intermediate(rhs.m_intermediate) {
+  m_intermediate(rhs.m_intermediate),
+  m_instruction(rhs.m_instruction) {
 	RESET() = rhs.RESET();
 	INT() = rhs.INT();
 }
@@ -117,12 +118,57 @@ void EightBit::Processor::setShort(const register16_t address, const register16_
 	setShort(value);
 }
 
+void EightBit::Processor::trap(const uint16_t address, handler_t handler) {
+	untrap(address);
+	if (m_traps == nullptr)
+		m_traps = std::make_unique<std::bitset<0x10000>>();
+	m_handlers.push_back({ address, std::move(handler) });
+	(*m_traps)[address] = true;
+}
+
+void EightBit::Processor::untrap(const uint16_t address) noexcept {
+	if (!trapped(address))
+		return;
+	(*m_traps)[address] = false;
+	const auto found = std::find_if(m_handlers.begin(), m_handlers.end(), [address](const trap_t& trap) { return trap.address == address; });
+	assert(found != m_handlers.end());
+	m_handlers.erase(found);
+	if (m_handlers.empty())
+		m_traps.reset();
+}
+
+void EightBit::Processor::spring() noexcept {
+	const auto address = PC().joined;
+	for (const auto& trap : m_handlers) {
+		if (trap.address == address) {
+			const auto handler = trap.handler;	// Free to untrap itself
+			handler(EventArgs::empty());
+			return;
+		}
+	}
+}
+
+size_t EightBit::Processor::watchpoint(const uint16_t begin, const uint16_t end, const bool reads, const bool writes, Bus::watcher_t watcher) {
+	return BUS().watchpoint(begin, end, reads, writes, [this, watcher = std::move(watcher)](WatchpointEventArgs& e) {
+		WatchpointEventArgs stamped(e.address(), e.before(), e.after(), e.writing(), e.cycle() + cycles(), m_instruction);
+		watcher(stamped);
+	});
+}
+
+bool EightBit::Processor::removeWatchpoint(const size_t id) noexcept {
+	return BUS().removeWatchpoint(id);
+}
+
 int EightBit::Processor::step() noexcept {
 	resetCycles();
+	if (UNLIKELY(trapped(PC())))
+		spring();
+	startInstruction();
 	ExecutingInstruction.fire();
 	if (powered())
 		poweredStep();
 	ExecutedInstruction.fire();
+	BUS().scheduler().elapse(cycles());
 	return cycles();
 }
 
@@ -133,6 +179,47 @@ int EightBit::Processor::run(const int limit) noexcept {
 	return current;
 }
 
+uint64_t EightBit::Processor::runUntil(const uint64_t deadline) noexcept {
+	const auto& scheduler = BUS().scheduler();
+	const auto start = scheduler.now();
+	while (LIKELY(powered() && (scheduler.now() < deadline))) {
+		const auto pc = PC();
+		const auto period = step();
+		if (UNLIKELY(PC() == pc) && spinning() && !observed() && !trapped(pc) && quiet(pc))
+			fastForward(period, std::min(deadline, scheduler.next()));
+	}
+	return scheduler.now() - start;
+}
+
+// Skipped repeats never touch the bus, so the loop, and any operands it
+// reads, must be in plain memory: not a device, nor a read watched page.
+bool EightBit::Processor::quiet(const register16_t pc) noexcept {
+	const register16_t last = pc.joined + 2;
+	return (BUS().readable(pc.high) != nullptr) && (BUS().readable(last.high) != nullptr);
+}
+
+// Skips as many repeats of the step just taken as it takes to reach "until",
+// leaving the clock exactly where single stepping would have.
+void EightBit::Processor::fastForward(const int period, const uint64_t until) noexcept {
+	auto& scheduler = BUS().scheduler();
+	if ((period <= 0) || (scheduler.now() >= until))
+		return;
+	const uint64_t limit = std::numeric_limits<int>::max() / period;
+	const auto iterations = std::min((until - scheduler.now() + period - 1) / period, limit);
+	const auto skipped = iterations * period;
+	resetCycles();
+	tick(static_cast<int>(skipped));
+	spin(iterations);
+	scheduler.elapse(skipped);
+}
+
+bool EightBit::Processor::observed() const noexcept {
+	return
+		ExecutingInstruction.active() || ExecutedInstruction.active()
+		|| ReadingMemory.active() || ReadMemory.active()
+		|| WritingMemory.active() || WrittenMemory.active();
+}
+
 void EightBit::Processor::execute(const uint8_t value) noexcept {
 	opcode() = value;
 	execute();
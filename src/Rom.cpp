@@ -80,3 +80,11 @@ int EightBit::Rom::load(const std::vector<uint8_t>& bytes, const int writeOffset
 uint8_t EightBit::Rom::peek(const uint16_t address) const noexcept {
 	return BYTES()[address];
 }
+
+uint8_t* EightBit::Rom::data(const uint16_t address) noexcept {
+	return address < BYTES().size() ? BYTES().data() + address : nullptr;
+}
+
+const uint8_t* EightBit::Rom::data(const uint16_t address) const noexcept {
+	return address < BYTES().size() ? BYTES().data() + address : nullptr;
+}
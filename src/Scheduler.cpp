@@ -0,0 +1,68 @@
+#include "stdafx.h"
+#include "../inc/Scheduler.h"
+
+bool EightBit::Scheduler::later(const event_t& lhs, const event_t& rhs) noexcept {
+	return lhs.when == rhs.when ? lhs.id > rhs.id : lhs.when > rhs.when;
+}
+
+void EightBit::Scheduler::push(event_t event) {
+	m_events.push_back(std::move(event));
+	std::push_heap(m_events.begin(), m_events.end(), later);
+	updateNext();
+}
+
+EightBit::Scheduler::event_t EightBit::Scheduler::pop() noexcept {
+	std::pop_heap(m_events.begin(), m_events.end(), later);
+	auto event = std::move(m_events.back());
+	m_events.pop_back();
+	updateNext();
+	return event;
+}
+
+size_t EightBit::Scheduler::at(const uint64_t when, handler_t handler) {
+	const auto id = ++m_last;
+	push({ when, 0, id, std::move(handler) });
+	return id;
+}
+
+size_t EightBit::Scheduler::every(const uint64_t period, handler_t handler) {
+	assert(period > 0);
+	const auto id = ++m_last;
+	push({ m_now + period, period, id, std::move(handler) });
+	return id;
+}
+
+bool EightBit::Scheduler::cancel(const size_t id) noexcept {
+	if (id == m_dispatching) {
+		m_cancelled = true;
+		return true;
+	}
+	const auto found = std::find_if(m_events.begin(), m_events.end(), [id](const event_t& event) { return event.id == id; });
+	if (found == m_events.end())
+		return false;
+	m_events.erase(found);
+	std::make_heap(m_events.begin(), m_events.end(), later);
+	updateNext();
+	return true;
+}
+
+void EightBit::Scheduler::clear() noexcept {
+	m_events.clear();
+	updateNext();
+	if (m_dispatching != 0)
+		m_cancelled = true;
+}
+
+void EightBit::Scheduler::dispatch() noexcept {
+	while (m_now >= m_next) {
+		auto event = pop();
+		m_dispatching = event.id;
+		m_cancelled = false;
+		event.handler(EventArgs::empty());
+		m_dispatching = 0;
+		if ((event.period > 0) && !m_cancelled) {
+			event.when += event.period;
+			push(std::move(event));
+		}
+	}
+}
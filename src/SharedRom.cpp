@@ -0,0 +1,49 @@
+#include "stdafx.h"
+#include "../inc/SharedRom.h"
+#include "../inc/Rom.h"
+
+#include <cassert>
+
+EightBit::SharedRom::image_t EightBit::SharedRom::image(const std::string path) {
+	std::vector<uint8_t> bytes;
+	Rom::load(path, bytes, 0, 0, -1, 0x10000);
+	return image(std::move(bytes));
+}
+
+EightBit::SharedRom::image_t EightBit::SharedRom::image(std::vector<uint8_t> bytes) {
+	assert(bytes.size() <= 0x10000);
+	return std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+}
+
+EightBit::SharedRom::SharedRom(image_t image) noexcept
+: m_image(std::move(image)) {
+	assert(m_image != nullptr);
+}
+
+uint16_t EightBit::SharedRom::size() const noexcept {
+	return static_cast<uint16_t>(IMAGE()->size());
+}
+
+uint8_t EightBit::SharedRom::peek(const uint16_t address) const noexcept {
+	return (*IMAGE())[address];
+}
+
+const uint8_t* EightBit::SharedRom::data(const uint16_t address) const noexcept {
+	return address < IMAGE()->size() ? IMAGE()->data() + address : nullptr;
+}
+
+int EightBit::SharedRom::load(std::ifstream&, int, int, int) {
+	throw std::logic_error("load operation not allowed.");
+}
+
+int EightBit::SharedRom::load(std::string, int, int, int) {
+	throw std::logic_error("load operation not allowed.");
+}
+
+int EightBit::SharedRom::load(const std::vector<uint8_t>&, int, int, int) {
+	throw std::logic_error("load operation not allowed.");
+}
+
+void EightBit::SharedRom::poke(uint16_t, uint8_t) noexcept {
+	assert(false && "Poke operation not allowed.");
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <Bus.h>
 #include <Ram.h>
+#include <SharedRom.h>
 #include <Chip.h>
 
 // Minimal Bus whose entire address space maps to a single read-only RAM region.
@@ -22,8 +23,50 @@ namespace {
         /// Reads directly from the backing RAM, bypassing the access-level guard.
         uint8_t rawPeek(uint16_t address) const { return m_ram.peek(address); }
 
-        const EightBit::MemoryMapping& mapping(uint16_t) noexcept final { return m_mapping; }
-        void initialise() noexcept final {}
+        EightBit::MemoryMapping mapping(uint16_t) noexcept final { return m_mapping; }
+        void initialise() noexcept final { remap(); }
+    };
+
+    // 0x0000 - 0x7FFF RAM, 0x8000 - 0xFFFF ROM, with an optional I/O page.
+    class PagedBus : public EightBit::Bus {
+        EightBit::Ram m_ram{ 0x8000 };
+        EightBit::Rom m_rom{ 0x8000 };
+        EightBit::MemoryMapping m_ramMapping{ m_ram, 0x0000, EightBit::Chip::Mask16, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+        EightBit::MemoryMapping m_romMapping{ m_rom, 0x8000, EightBit::Chip::Mask16, EightBit::MemoryMapping::AccessLevel::ReadOnly };
+    public:
+        int mapped = 0;
+
+        EightBit::MemoryMapping mapping(uint16_t address) noexcept final {
+            ++mapped;
+            return address < 0x8000 ? m_ramMapping : m_romMapping;
+        }
+
+        void initialise() noexcept final { remap(); }
+
+        void io(uint8_t page) {
+            markIO(page);
+            remap();
+        }
+    };
+
+    // 0x0000 - 0x7FFF RAM, 0x8000 - 0xFFFF a ROM image shared with other buses.
+    class SharedBus : public EightBit::Bus {
+        EightBit::Ram m_ram{ 0x8000 };
+        EightBit::SharedRom m_rom;
+        EightBit::MemoryMapping m_ramMapping{ m_ram, 0x0000, EightBit::Chip::Mask16, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+        EightBit::MemoryMapping m_romMapping{ m_rom, 0x8000, EightBit::Chip::Mask16, EightBit::MemoryMapping::AccessLevel::ReadOnly };
+    public:
+        int mapped = 0;
+
+        SharedBus(EightBit::SharedRom::image_t image)
+            : m_rom(std::move(image)) {}
+
+        EightBit::MemoryMapping mapping(uint16_t address) noexcept final {
+            ++mapped;
+            return address < 0x8000 ? m_ramMapping : m_romMapping;
+        }
+
+        void initialise() noexcept final { remap(); }
     };
 }
 
@@ -60,4 +103,219 @@ BOOST_AUTO_TEST_CASE(read_after_write_to_ReadOnly_returns_original_value) {
     BOOST_CHECK_EQUAL(bus.DATA(), 0x42);
 }
 
+BOOST_AUTO_TEST_CASE(remapped_ReadOnly_write_does_not_modify_memory) {
+    ReadOnlyBus bus;
+    bus.initialise();
+    bus.seed(0x4000, 0x24);
+    bus.ADDRESS() = 0x4000;
+    bus.DATA() = 0xFF;
+    bus.write();
+    BOOST_CHECK_EQUAL(bus.rawPeek(0x4000), 0x24);
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.DATA(), 0x24);
+}
+
+BOOST_AUTO_TEST_CASE(remapped_read_and_write_bypass_mapping) {
+    PagedBus bus;
+    bus.initialise();
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1234;
+    bus.DATA() = 0x5A;
+    bus.write();
+    bus.DATA() = 0x00;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.DATA(), 0x5A);
+    bus.ADDRESS() = 0x8000;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.DATA(), 0x00);
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+    BOOST_CHECK_EQUAL(bus.peek(0x1234), 0x5A);
+}
+
+BOOST_AUTO_TEST_CASE(io_page_uses_mapping) {
+    PagedBus bus;
+    bus.initialise();
+    bus.io(0x12);
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1234;
+    bus.DATA() = 0x5A;
+    bus.write();
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.DATA(), 0x5A);
+    BOOST_CHECK_EQUAL(bus.mapped, 2);
+}
+
+BOOST_AUTO_TEST_CASE(attached_device_sees_only_its_range) {
+    PagedBus bus;
+    bus.initialise();
+    std::vector<uint16_t> reads, writes;
+    bus.attach(0x1210, 0x121f,
+        [&bus, &reads](EightBit::EventArgs&) {
+            reads.push_back(bus.ADDRESS().joined);
+            bus.poke(0xA5);
+        },
+        [&bus, &writes](EightBit::EventArgs&) {
+            writes.push_back(bus.ADDRESS().joined);
+        });
+    for (const uint16_t address : { 0x1200, 0x1210, 0x121f, 0x1220, 0x1310 }) {
+        bus.ADDRESS() = address;
+        bus.DATA() = 0x5A;
+        bus.write();
+        bus.read();
+    }
+    BOOST_REQUIRE_EQUAL(reads.size(), 2);
+    BOOST_CHECK_EQUAL(reads[0], 0x1210);
+    BOOST_CHECK_EQUAL(reads[1], 0x121f);
+    BOOST_CHECK(writes == reads);
+    BOOST_CHECK_EQUAL(bus.peek(0x1210), 0xA5);
+    BOOST_CHECK_EQUAL(bus.peek(0x1200), 0x5A);
+
+    // The rest of the page leaves the page table, other pages don't
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1310;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+    bus.ADDRESS() = 0x1200;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.mapped, 1);
+}
+
+BOOST_AUTO_TEST_CASE(write_only_device_leaves_reads_on_page_table) {
+    PagedBus bus;
+    bus.initialise();
+    std::vector<uint16_t> writes;
+    bus.attachWriteOnly(0x1000, 0x1fff,
+        [&bus, &writes](EightBit::EventArgs&) {
+            writes.push_back(bus.ADDRESS().joined);
+        });
+    BOOST_CHECK(bus.readable(0x10) != nullptr);
+    BOOST_CHECK(bus.readable(0x1f) != nullptr);
+    BOOST_CHECK(bus.writable(0x10) == nullptr);
+    BOOST_CHECK(bus.writable(0x20) != nullptr);
+
+    for (const uint16_t address : { 0x0fff, 0x1000, 0x1fff, 0x2000 }) {
+        bus.ADDRESS() = address;
+        bus.DATA() = 0x5A;
+        bus.write();
+    }
+    BOOST_REQUIRE_EQUAL(writes.size(), 2);
+    BOOST_CHECK_EQUAL(writes[0], 0x1000);
+    BOOST_CHECK_EQUAL(writes[1], 0x1fff);
+    BOOST_CHECK_EQUAL(bus.peek(0x1000), 0x5A);
+
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1000;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.DATA(), 0x5A);
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+
+    // Rebuilding the page table keeps writes off it
+    bus.initialise();
+    BOOST_CHECK(bus.readable(0x10) != nullptr);
+    BOOST_CHECK(bus.writable(0x10) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(watched_page_writes_are_announced) {
+    PagedBus bus;
+    bus.initialise();
+    bus.watch(0x12);
+    std::vector<uint16_t> written;
+    bus.WrittenWatchedPage.connect([&written](EightBit::register16_t address) {
+        written.push_back(address.joined);
+    });
+    bus.mapped = 0;
+    for (const uint16_t address : { 0x1234, 0x1334 }) {
+        bus.ADDRESS() = address;
+        bus.DATA() = 0x5A;
+        bus.write();
+    }
+    BOOST_REQUIRE_EQUAL(written.size(), 1);
+    BOOST_CHECK_EQUAL(written[0], 0x1234);
+    BOOST_CHECK_EQUAL(bus.mapped, 1);
+    BOOST_CHECK_EQUAL(bus.peek(0x1234), 0x5A);
+
+    bus.unwatch(0x12);
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1234;
+    bus.write();
+    BOOST_CHECK_EQUAL(written.size(), 1);
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+}
+
+BOOST_AUTO_TEST_CASE(watchpoints_report_accesses_in_range) {
+    PagedBus bus;
+    bus.initialise();
+    bus.poke(0x1234, 0x11);
+    std::vector<EightBit::WatchpointEventArgs> hits;
+    const auto id = bus.watchpoint(0x1230, 0x123f, true, true, [&hits](EightBit::WatchpointEventArgs& e) {
+        hits.push_back(e);
+    });
+    bus.scheduler().elapse(100);
+    for (const uint16_t address : { 0x1234, 0x1240, 0x1334 }) {
+        bus.ADDRESS() = address;
+        bus.DATA() = 0x5A;
+        bus.write();
+        bus.read();
+    }
+    BOOST_REQUIRE_EQUAL(hits.size(), 2);
+    BOOST_CHECK(hits[0].writing());
+    BOOST_CHECK_EQUAL(hits[0].address().joined, 0x1234);
+    BOOST_CHECK_EQUAL(hits[0].before(), 0x11);
+    BOOST_CHECK_EQUAL(hits[0].after(), 0x5A);
+    BOOST_CHECK_EQUAL(hits[0].cycle(), 100);
+    BOOST_CHECK(hits[1].reading());
+    BOOST_CHECK_EQUAL(hits[1].before(), 0x5A);
+
+    // Only the watched page leaves the page table, and only until the watchpoint is removed
+    bus.mapped = 0;
+    bus.ADDRESS() = 0x1334;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+    bus.ADDRESS() = 0x1240;
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.mapped, 1);
+
+    BOOST_CHECK(bus.removeWatchpoint(id));
+    BOOST_CHECK(!bus.removeWatchpoint(id));
+    bus.mapped = 0;
+    bus.write();
+    bus.read();
+    BOOST_CHECK_EQUAL(bus.mapped, 0);
+    BOOST_CHECK_EQUAL(hits.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(mapping_offset_is_masked_from_begin) {
+    EightBit::Ram ram{ 0x800 };
+    const EightBit::MemoryMapping mapping{ ram, 0x2000, 0x7ff, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+    BOOST_CHECK_EQUAL(mapping.offset(0x2000), 0x000);
+    BOOST_CHECK_EQUAL(mapping.offset(0x27ff), 0x7ff);
+    BOOST_CHECK_EQUAL(mapping.offset(0x2801), 0x001);
+    BOOST_CHECK_EQUAL(mapping.offset(0x3fff), 0x7ff);
+}
+
+BOOST_AUTO_TEST_CASE(shared_image_is_read_through_page_table) {
+    const auto image = EightBit::SharedRom::image(std::vector<uint8_t>(0x8000, 0xC9));
+    SharedBus first(image), second(image);
+    for (auto* bus : { &first, &second }) {
+        bus->initialise();
+        bus->mapped = 0;
+        bus->ADDRESS() = 0x8123;
+        bus->read();
+        BOOST_CHECK_EQUAL(bus->DATA(), 0xC9);
+        BOOST_CHECK_EQUAL(bus->mapped, 0);
+        bus->DATA() = 0x00;
+        bus->write();   // Read only, so no page to write through
+        BOOST_CHECK_EQUAL(bus->mapped, 1);
+        BOOST_CHECK_EQUAL(bus->peek(0x8123), 0xC9);
+    }
+    BOOST_CHECK_EQUAL(image.use_count(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(footprint_excludes_shared_images) {
+    PagedBus paged;
+    BOOST_CHECK_EQUAL(paged.footprint(), 0x10000);
+    SharedBus shared(EightBit::SharedRom::image(std::vector<uint8_t>(0x8000)));
+    BOOST_CHECK_EQUAL(shared.footprint(), 0x8000);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
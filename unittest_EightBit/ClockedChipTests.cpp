@@ -0,0 +1,124 @@
+#include "pch.h"
+#include <ClockedChip.h>
+#include <Scheduler.h>
+
+#include <vector>
+
+namespace {
+    // Records each catch-up, and can ask to be woken after a number of cycles.
+    class LazyChip : public EightBit::ClockedChip {
+    public:
+        std::vector<uint64_t> advances;
+        uint64_t wake = Never;
+
+        LazyChip() = default;
+        LazyChip(EightBit::Scheduler& scheduler) : EightBit::ClockedChip(scheduler) {}
+
+        void wakeAfter(uint64_t cycles) { wake = cycles; schedule(cycles); }
+
+        [[nodiscard]] auto lastUpdated() const noexcept { return updated(); }
+
+    protected:
+        void advance(uint64_t cycles) noexcept final {
+            advances.push_back(cycles);
+            if (wake != Never)
+                schedule(wake);
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(ClockedChip)
+
+BOOST_AUTO_TEST_CASE(ticks_only_count_cycles) {
+    EightBit::Scheduler scheduler;
+    LazyChip chip(scheduler);
+    chip.tick(100);
+    chip.tick();
+    BOOST_CHECK(chip.advances.empty());
+    BOOST_CHECK_EQUAL(chip.cycles(), 101);
+    BOOST_CHECK_EQUAL(scheduler.now(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(catch_up_advances_by_elapsed_scheduler_cycles_in_one_go) {
+    EightBit::Scheduler scheduler;
+    LazyChip chip(scheduler);
+    scheduler.elapse(40);
+    scheduler.elapse(2);
+    chip.catchUp();
+    chip.catchUp();
+    BOOST_REQUIRE_EQUAL(chip.advances.size(), 1);
+    BOOST_CHECK_EQUAL(chip.advances[0], 42);
+    BOOST_CHECK_EQUAL(chip.lastUpdated(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(chip_without_a_scheduler_is_never_advanced) {
+    LazyChip chip;
+    chip.tick(10);
+    chip.catchUp();
+    BOOST_CHECK(chip.advances.empty());
+}
+
+BOOST_AUTO_TEST_CASE(scheduled_deadline_is_a_scheduler_event) {
+    EightBit::Scheduler scheduler;
+    LazyChip chip(scheduler);
+    chip.wakeAfter(10);
+    BOOST_CHECK_EQUAL(scheduler.pending(), 1);
+    BOOST_CHECK_EQUAL(scheduler.next(), 10);
+    scheduler.elapse(4);
+    BOOST_CHECK(chip.advances.empty());
+    scheduler.elapse(7);
+    scheduler.elapse(9);
+    BOOST_CHECK_EQUAL(chip.advances.size(), 1);
+    scheduler.elapse(1);
+    BOOST_REQUIRE_EQUAL(chip.advances.size(), 2);
+    BOOST_CHECK_EQUAL(chip.advances[0], 11);
+    BOOST_CHECK_EQUAL(chip.advances[1], 10);
+    BOOST_CHECK_EQUAL(scheduler.pending(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(catch_up_keeps_a_deadline_it_has_not_reached) {
+    EightBit::Scheduler scheduler;
+    LazyChip chip(scheduler);
+    chip.wakeAfter(10);
+    scheduler.elapse(4);
+    chip.catchUp();
+    chip.catchUp();
+    BOOST_CHECK_EQUAL(scheduler.pending(), 1);
+    BOOST_CHECK_EQUAL(scheduler.next(), 10);
+    scheduler.elapse(6);
+    BOOST_REQUIRE_EQUAL(chip.advances.size(), 2);
+    BOOST_CHECK_EQUAL(chip.advances[0], 4);
+    BOOST_CHECK_EQUAL(chip.advances[1], 6);
+    BOOST_CHECK_EQUAL(scheduler.next(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(earlier_deadline_replaces_a_later_one) {
+    EightBit::Scheduler scheduler;
+    LazyChip chip(scheduler);
+    chip.wakeAfter(50);
+    chip.wakeAfter(5);
+    chip.wakeAfter(20);
+    BOOST_CHECK_EQUAL(scheduler.pending(), 1);
+    BOOST_CHECK_EQUAL(scheduler.next(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(destroyed_chip_cancels_its_deadline) {
+    EightBit::Scheduler scheduler;
+    {
+        LazyChip chip(scheduler);
+        chip.wakeAfter(10);
+    }
+    BOOST_CHECK_EQUAL(scheduler.pending(), 0);
+    scheduler.elapse(20);
+}
+
+BOOST_AUTO_TEST_CASE(ticked_still_fires_every_cycle) {
+    LazyChip chip;
+    int ticks = 0;
+    chip.Ticked.connect([&ticks](EightBit::EventArgs&) { ++ticks; });
+    chip.tick(3);
+    chip.tick();
+    BOOST_CHECK_EQUAL(ticks, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
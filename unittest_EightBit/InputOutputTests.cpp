@@ -0,0 +1,28 @@
+#include "pch.h"
+#include <InputOutput.h>
+
+BOOST_AUTO_TEST_SUITE(InputOutput)
+
+BOOST_AUTO_TEST_CASE(unwritten_ports_read_as_zero_without_allocating) {
+    EightBit::InputOutput ports;
+    BOOST_CHECK_EQUAL(ports.read(0x1234), 0);
+    BOOST_CHECK_EQUAL(ports.readOutputPort(0xffff), 0);
+    BOOST_CHECK_EQUAL(ports.footprint(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ports_are_allocated_a_page_at_a_time) {
+    EightBit::InputOutput ports;
+    ports.writeInputPort(0x12fe, 0x5a);
+    const auto first = ports.footprint();
+    ports.writeInputPort(0x1201, 0xa5);
+    BOOST_CHECK_EQUAL(ports.footprint(), first);
+    BOOST_CHECK_EQUAL(ports.read(0x12fe), 0x5a);
+    BOOST_CHECK_EQUAL(ports.read(0x1201), 0xa5);
+    BOOST_CHECK_EQUAL(ports.read(0x13fe), 0);
+    BOOST_CHECK_EQUAL(ports.readOutputPort(0x12fe), 0);
+    ports.write(0x12fe, 0x77);
+    BOOST_CHECK_EQUAL(ports.readOutputPort(0x12fe), 0x77);
+    BOOST_CHECK_GT(ports.footprint(), first);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
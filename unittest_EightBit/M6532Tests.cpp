@@ -0,0 +1,81 @@
+#include "pch.h"
+#include <M6532.h>
+#include <Scheduler.h>
+
+namespace {
+    // A powered, reset 6532, accessed a bus cycle at a time
+    class Riot final {
+    public:
+        EightBit::Scheduler scheduler;
+        EightBit::M6532 chip{ scheduler };
+
+        // The first access, whilst RES is still low, resets the chip
+        Riot() {
+            chip.raisePOWER();
+            chip.raiseCS1();
+            chip.lowerCS1();
+        }
+
+        void write(uint8_t address, uint8_t value, bool ram = false) {
+            setup(address, ram);
+            chip.lowerRW();
+            chip.DATA() = value;
+            chip.raiseCS1();
+            chip.lowerCS1();
+        }
+
+        // Only what is on the data bus whilst the chip is selected
+        [[nodiscard]] uint8_t read(uint8_t address, bool ram = false) {
+            setup(address, ram);
+            chip.raiseRW();
+            chip.DATA() = 0;
+            chip.raiseCS1();
+            const auto returned = chip.DATA();
+            chip.lowerCS1();
+            return returned;
+        }
+
+        [[nodiscard]] bool interrupting() const noexcept { return EightBit::M6532::lowered(chip.IRQ()); }
+
+    private:
+        void setup(uint8_t address, bool ram) {
+            chip.address() = address;
+            ram ? chip.lowerRS() : chip.raiseRS();
+        }
+    };
+
+    constexpr uint8_t DDRA = 0b00001;
+    constexpr uint8_t Timer8T = 0b11101;   // Interrupt enabled
+}
+
+BOOST_AUTO_TEST_SUITE(M6532)
+
+BOOST_AUTO_TEST_CASE(selected_mid_instruction_drives_the_data_bus_in_the_same_cycle) {
+    Riot riot;
+    riot.write(0x12, 0x5a, true);
+    riot.scheduler.elapse(2);
+    BOOST_CHECK_EQUAL(riot.read(0x12, true), 0x5a);
+    BOOST_CHECK_EQUAL(riot.scheduler.now(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ram_and_registers_are_written_and_read_whilst_selected) {
+    Riot riot;
+    riot.write(0x7f, 0xa5, true);
+    riot.write(DDRA, 0x3c);
+    BOOST_CHECK_EQUAL(riot.read(0x7f, true), 0xa5);
+    BOOST_CHECK_EQUAL(riot.read(0xff, true), 0xa5);    // A7 isn't decoded
+    BOOST_CHECK_EQUAL(riot.read(DDRA), 0x3c);
+}
+
+BOOST_AUTO_TEST_CASE(timer_expiry_raises_an_interrupt_on_the_expected_cycle) {
+    Riot riot;
+    riot.scheduler.elapse(100);
+    riot.write(Timer8T, 4);
+    BOOST_CHECK_EQUAL(riot.scheduler.next(), 100 + 4 * 8);
+    riot.scheduler.elapse(31);
+    BOOST_CHECK(!riot.interrupting());
+    riot.scheduler.elapse(1);
+    BOOST_CHECK(riot.interrupting());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
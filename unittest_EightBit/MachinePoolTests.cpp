@@ -0,0 +1,105 @@
+#include "pch.h"
+#include <MachinePool.h>
+#include <LittleEndianProcessor.h>
+#include <Bus.h>
+#include <Ram.h>
+
+#include <vector>
+
+namespace {
+    // Every instruction takes a cycle: 0xff powers down, anything else is added to A.
+    class AddingProcessor final : public EightBit::LittleEndianProcessor {
+    public:
+        uint8_t A = 0;
+
+        AddingProcessor(EightBit::Bus& bus) noexcept
+        : LittleEndianProcessor(bus) {}
+
+        void poweredStep() noexcept final { Processor::execute(fetchInstruction()); }
+
+        void execute() noexcept final {
+            tick();
+            if (opcode() == 0xff)
+                lowerPOWER();
+            else
+                A += opcode();
+        }
+
+    protected:
+        void push(uint8_t) noexcept final {}
+        void pop() noexcept final {}
+    };
+
+    struct AddingConfiguration {
+        uint8_t seed = 0;
+    };
+
+    class AddingBoard final : public EightBit::Bus {
+        EightBit::Ram m_ram{ 0x10000 };
+        EightBit::MemoryMapping m_mapping{ m_ram, 0x0000, EightBit::Chip::Mask16, EightBit::MemoryMapping::AccessLevel::ReadWrite };
+        AddingProcessor m_cpu{ *this };
+        const AddingConfiguration& m_configuration;
+
+    public:
+        AddingBoard(const AddingConfiguration& configuration) noexcept
+        : m_configuration(configuration) {}
+
+        auto& CPU() noexcept { return m_cpu; }
+
+        EightBit::MemoryMapping mapping(uint16_t) noexcept final { return m_mapping; }
+        void initialise() noexcept final { remap(); }
+
+        void raisePOWER() noexcept final {
+            Bus::raisePOWER();
+            CPU().raisePOWER();
+            CPU().A = m_configuration.seed;
+        }
+    };
+
+    typedef EightBit::MachinePool<AddingConfiguration, AddingBoard, int> pool_t;
+
+    pool_t::inspector_t accumulator() {
+        return [](AddingBoard& board) { return int(board.CPU().A); };
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(MachinePool)
+
+BOOST_AUTO_TEST_CASE(job_runs_until_powered_down) {
+    pool_t pool(
+        [](const AddingConfiguration& configuration) { return std::make_unique<AddingBoard>(configuration); },
+        accumulator());
+    pool.add({ { 10 }, { 1, 2, 3, 0xff } });
+    const auto& results = pool.run();
+    BOOST_REQUIRE_EQUAL(results.size(), 1);
+    BOOST_CHECK(results[0].completed);
+    BOOST_CHECK(!results[0].error);
+    BOOST_CHECK_EQUAL(results[0].cycles, 4);
+    BOOST_CHECK_EQUAL(results[0].state, 16);
+}
+
+BOOST_AUTO_TEST_CASE(job_stops_at_its_cycle_budget) {
+    pool_t pool({}, accumulator());
+    pool.add({ { 0 }, { 1, 1, 1, 1, 1, 1, 0xff }, 0, 3 });
+    const auto& results = pool.run();
+    BOOST_CHECK(!results[0].completed);
+    BOOST_CHECK_EQUAL(results[0].cycles, 3);
+    BOOST_CHECK_EQUAL(results[0].state, 3);
+}
+
+BOOST_AUTO_TEST_CASE(results_follow_job_order_across_threads) {
+    pool_t pool({}, accumulator());
+    pool.threads() = 4;
+    for (int i = 0; i < 50; ++i)
+        pool.add({ { static_cast<uint8_t>(i) }, { static_cast<uint8_t>(i % 7), 0xff }, 0x100 });
+    const auto& results = pool.run();
+    BOOST_REQUIRE_EQUAL(results.size(), 50);
+    for (int i = 0; i < 50; ++i) {
+        // Execution starts at zero, so it runs through the NOPs to the image at 0x100
+        BOOST_CHECK_EQUAL(results[i].cycles, 0x102);
+        BOOST_CHECK_EQUAL(results[i].state, i + i % 7);
+        BOOST_CHECK_LT(results[i].worker, 4U);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include <Scheduler.h>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Scheduler)
+
+BOOST_AUTO_TEST_CASE(empty_scheduler_only_keeps_time) {
+    EightBit::Scheduler scheduler;
+    BOOST_CHECK_EQUAL(scheduler.next(), EightBit::Scheduler::Never);
+    scheduler.elapse(10);
+    scheduler.elapse(5);
+    BOOST_CHECK_EQUAL(scheduler.now(), 15);
+}
+
+BOOST_AUTO_TEST_CASE(events_are_dispatched_in_due_order) {
+    EightBit::Scheduler scheduler;
+    std::vector<int> fired;
+    scheduler.at(30, [&fired](EightBit::EventArgs&) { fired.push_back(3); });
+    scheduler.at(10, [&fired](EightBit::EventArgs&) { fired.push_back(1); });
+    scheduler.at(20, [&fired](EightBit::EventArgs&) { fired.push_back(2); });
+    scheduler.at(20, [&fired](EightBit::EventArgs&) { fired.push_back(4); });
+    BOOST_CHECK_EQUAL(scheduler.next(), 10);
+
+    scheduler.elapse(9);
+    BOOST_CHECK(fired.empty());
+    scheduler.elapse(15);
+    BOOST_REQUIRE_EQUAL(fired.size(), 3);
+    BOOST_CHECK_EQUAL(fired[0], 1);
+    BOOST_CHECK_EQUAL(fired[1], 2);
+    BOOST_CHECK_EQUAL(fired[2], 4);
+    BOOST_CHECK_EQUAL(scheduler.next(), 30);
+}
+
+BOOST_AUTO_TEST_CASE(periodic_events_keep_their_phase) {
+    EightBit::Scheduler scheduler;
+    std::vector<uint64_t> fired;
+    scheduler.every(100, [&](EightBit::EventArgs&) { fired.push_back(scheduler.now()); });
+    scheduler.elapse(103);
+    scheduler.elapse(98);
+    scheduler.elapse(99);
+    BOOST_REQUIRE_EQUAL(fired.size(), 3);
+    BOOST_CHECK_EQUAL(fired[1], 201);
+    BOOST_CHECK_EQUAL(scheduler.next(), 400);
+}
+
+BOOST_AUTO_TEST_CASE(cancelled_events_are_not_dispatched) {
+    EightBit::Scheduler scheduler;
+    int fired = 0;
+    const auto once = scheduler.after(5, [&fired](EightBit::EventArgs&) { ++fired; });
+    BOOST_CHECK(scheduler.cancel(once));
+    BOOST_CHECK(!scheduler.cancel(once));
+    size_t periodic = 0;
+    periodic = scheduler.every(5, [&](EightBit::EventArgs&) { ++fired; scheduler.cancel(periodic); });
+    scheduler.elapse(50);
+    BOOST_CHECK_EQUAL(fired, 1);
+    BOOST_CHECK_EQUAL(scheduler.pending(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(handlers_may_schedule_further_events) {
+    EightBit::Scheduler scheduler;
+    int fired = 0;
+    scheduler.at(10, [&](EightBit::EventArgs&) {
+        ++fired;
+        scheduler.after(0, [&fired](EightBit::EventArgs&) { ++fired; });
+    });
+    scheduler.elapse(10);
+    BOOST_CHECK_EQUAL(fired, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
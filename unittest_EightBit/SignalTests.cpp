@@ -0,0 +1,156 @@
+#include "pch.h"
+#include <Signal.h>
+#include <EventArgs.h>
+
+#include <array>
+
+BOOST_AUTO_TEST_SUITE(Signal)
+
+BOOST_AUTO_TEST_CASE(fire_without_connections_does_nothing) {
+    EightBit::Signal<EightBit::EventArgs> signal;
+    BOOST_CHECK(signal.inactive());
+    signal.fire();
+}
+
+BOOST_AUTO_TEST_CASE(fire_calls_delegates_in_connection_order) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    signal.connect([&result](int& e) { result = result * 10 + e; });
+    signal.connect([&result](int& e) { result = result * 10 + e + 1; });
+    BOOST_CHECK_EQUAL(signal.count(), 2);
+    int value = 3;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 34);
+}
+
+BOOST_AUTO_TEST_CASE(small_callables_are_stored_inline) {
+    int* pointer = nullptr;
+    auto small = [pointer](int&) { (void)pointer; };
+    std::array<int, 32> large = {};
+    auto big = [large](int&) { (void)large; };
+    BOOST_CHECK(EightBit::Delegate<int>::stored_inline<decltype(small)>);
+    BOOST_CHECK(!EightBit::Delegate<int>::stored_inline<decltype(big)>);
+}
+
+BOOST_AUTO_TEST_CASE(large_callables_still_fire) {
+    EightBit::Signal<int> signal;
+    std::array<int, 32> large = {};
+    large[31] = 7;
+    int result = 0;
+    signal.connect([large, &result](int& e) { result = large[31] + e; });
+    int value = 1;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 8);
+}
+
+BOOST_AUTO_TEST_CASE(delegates_survive_reallocation) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    for (int i = 0; i < 100; ++i)
+        signal.connect([&result, i](int&) { result += i; });
+    int value = 0;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 4950);
+}
+
+BOOST_AUTO_TEST_CASE(disconnected_delegates_are_not_fired) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    auto connection = signal.connect([&result](int&) { ++result; });
+    BOOST_CHECK(connection.connected());
+    connection.disconnect();
+    BOOST_CHECK(!connection.connected());
+    BOOST_CHECK(signal.inactive());
+    int value = 0;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 0);
+}
+
+BOOST_AUTO_TEST_CASE(scoped_connection_disconnects_on_destruction) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    {
+        EightBit::ScopedConnection connection = signal.connect([&result](int&) { ++result; });
+        int value = 0;
+        signal.fire(value);
+    }
+    int value = 0;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 1);
+    BOOST_CHECK(signal.inactive());
+}
+
+BOOST_AUTO_TEST_CASE(blocked_delegates_are_skipped_until_unblocked) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    auto connection = signal.connect([&result](int&) { ++result; });
+    connection.block();
+    BOOST_CHECK(connection.blocked());
+    int value = 0;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 0);
+    connection.unblock();
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(result, 1);
+}
+
+BOOST_AUTO_TEST_CASE(delegate_may_disconnect_itself_while_firing) {
+    EightBit::Signal<int> signal;
+    int first = 0;
+    int second = 0;
+    EightBit::Connection connection;
+    connection = signal.connect([&](int&) { ++first; connection.disconnect(); });
+    signal.connect([&second](int&) { ++second; });
+    int value = 0;
+    signal.fire(value);
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(first, 1);
+    BOOST_CHECK_EQUAL(second, 2);
+    BOOST_CHECK_EQUAL(signal.count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(delegate_connected_while_firing_waits_for_next_fire) {
+    EightBit::Signal<int> signal;
+    int added = 0;
+    signal.connect([&](int&) {
+        if (signal.count() == 1)
+            signal.connect([&added](int&) { ++added; });
+    });
+    int value = 0;
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(added, 0);
+    signal.fire(value);
+    BOOST_CHECK_EQUAL(added, 1);
+}
+
+BOOST_AUTO_TEST_CASE(nested_fire_is_safe) {
+    EightBit::Signal<int> signal;
+    int result = 0;
+    signal.connect([&](int& depth) {
+        ++result;
+        if (depth-- > 0)
+            signal.fire(depth);
+    });
+    int depth = 3;
+    signal.fire(depth);
+    BOOST_CHECK_EQUAL(result, 4);
+}
+
+BOOST_AUTO_TEST_CASE(connection_may_outlive_signal) {
+    EightBit::Connection connection;
+    {
+        EightBit::Signal<int> signal;
+        connection = signal.connect([](int&) {});
+        BOOST_CHECK(connection.connected());
+    }
+    BOOST_CHECK(!connection.connected());
+    connection.disconnect();
+}
+
+BOOST_AUTO_TEST_CASE(null_signal_is_always_inactive) {
+    EightBit::NullSignal<EightBit::EventArgs> signal;
+    BOOST_CHECK(signal.inactive());
+    signal.fire();
+}
+
+BOOST_AUTO_TEST_SUITE_END()